@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+// End-to-end sweeps over random Clifford circuits, the evaluation of
+// "Towards a Satisfiability Encoding for Quantum Circuits". The ranges used in
+// the paper are marked with "Paper Evaluation:", the default ones are smaller.
+
+#include "Configuration.hpp"
+#include "GeneratorEncoding.hpp"
+#include "Profile.hpp"
+#include "SatEncoder.hpp"
+#include "Statistics.hpp"
+#include "algorithms/RandomCliffordCircuit.hpp"
+#include "circuit_optimizer/CircuitOptimizer.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+// seed of every circuit and input, so that all runs check the same instances
+constexpr std::uint32_t SEED = 42U;
+
+qc::QuantumComputation randomCircuit(const std::size_t nrOfQubits,
+                                     const std::size_t depth,
+                                     const std::uint32_t seed) {
+  auto circuit = qc::createRandomCliffordCircuit(
+      static_cast<qc::Qubit>(nrOfQubits), depth, seed);
+  qc::CircuitOptimizer::flattenOperations(circuit);
+  return circuit;
+}
+
+// random computational basis states on the first five qubits, the others are
+// |0>
+std::vector<std::string> randomInputs(const std::size_t nrOfQubits,
+                                      const std::size_t count,
+                                      std::mt19937&     gen) {
+  std::vector<std::string> inputs(count, std::string(nrOfQubits, 'I'));
+  for (auto& input : inputs) {
+    for (std::size_t q = 0U; q < nrOfQubits && q < 5U; q++) {
+      input[q] = gen() % 2U == 0U ? 'Z' : 'I';
+    }
+  }
+  return inputs;
+}
+
+constexpr std::array<ProfilePhase, 5U> REPORTED_PHASES{
+    ProfilePhase::DagConstruction, ProfilePhase::Simulation,
+    ProfilePhase::Interning, ProfilePhase::ConstraintBuilding,
+    ProfilePhase::Solving};
+
+// statistics of the checks of a benchmark, every iteration runs one check
+struct CheckStatistics {
+  Statistics                                        last{};
+  std::array<std::uint64_t, REPORTED_PHASES.size()> nanoseconds{};
+
+  void add(const Statistics& stats) {
+    last = stats;
+    for (std::size_t p = 0U; p < REPORTED_PHASES.size(); p++) {
+      nanoseconds[p] += stats.profile.nanoseconds(REPORTED_PHASES[p]);
+    }
+  }
+};
+
+// size of the instance and the mean time of the phases per check
+void reportStatistics(benchmark::State&      state,
+                      const CheckStatistics& checks) {
+  const auto& stats = checks.last;
+  state.counters["generators"] = static_cast<double>(stats.nrOfGenerators);
+  state.counters["satVars"]    = static_cast<double>(stats.nrOfSatVars);
+  state.counters["functionalConstraints"] =
+      static_cast<double>(stats.nrOfFunctionalConstr);
+  const auto iterations = static_cast<double>(state.iterations());
+  for (std::size_t p = 0U; p < REPORTED_PHASES.size(); p++) {
+    state.counters[toString(REPORTED_PHASES[p]) + "Ns"] =
+        static_cast<double>(checks.nanoseconds[p]) / iterations;
+  }
+}
+
+// scaling of the satisfiability check with the number of qubits and the depth
+void BM_CheckSatisfiability(benchmark::State& state) {
+  const auto nrOfQubits = static_cast<std::size_t>(state.range(0));
+  const auto depth      = static_cast<std::size_t>(state.range(1));
+  auto       circuit    = randomCircuit(nrOfQubits, depth, SEED);
+  CheckStatistics checks{};
+  for (auto _ : state) {
+    SatEncoder encoder{};
+    benchmark::DoNotOptimize(encoder.checkSatisfiability(circuit));
+    checks.add(encoder.getStats());
+  }
+  reportStatistics(state, checks);
+}
+// Paper Evaluation: qubits 1 to 128 for depths 10, 50, 250 and 1000, and
+// depths 1 to 500 for 5, 20, 65 and 127 qubits
+BENCHMARK(BM_CheckSatisfiability)
+    ->ArgsProduct({{2, 4, 8, 16}, {10, 50}})
+    ->ArgsProduct({{5, 20}, {1, 25, 50}})
+    ->ArgNames({"qubits", "depth"})
+    ->Unit(benchmark::kMillisecond);
+
+// equivalence check of a circuit against itself or against the circuit with
+// one gate removed, for 18 random basis states
+void checkEquivalence(benchmark::State& state, const bool equivalent,
+                      const Configuration& config) {
+  const auto   nrOfQubits = static_cast<std::size_t>(state.range(0));
+  const auto   depth      = static_cast<std::size_t>(state.range(1));
+  std::mt19937 gen(SEED);
+  const auto   inputs = randomInputs(nrOfQubits, 18U, gen);
+  auto         circOne = randomCircuit(nrOfQubits, depth, SEED);
+  auto         circTwo = circOne;
+  if (!equivalent) {
+    // removing a gate may keep the circuits equivalent for the inputs, the
+    // first removal that does not is used
+    bool found = false;
+    for (std::size_t gate = 0U; gate < circOne.size() && !found; gate++) {
+      circTwo = circOne;
+      circTwo.erase(circTwo.begin() + static_cast<std::ptrdiff_t>(
+                                          (gate + gen()) % circOne.size()));
+      SatEncoder encoder{};
+      found = !encoder.testEqual(circOne, circTwo, inputs);
+    }
+    if (!found) {
+      state.SkipWithError("no removed gate makes the circuits differ");
+      return;
+    }
+  }
+  CheckStatistics checks{};
+  for (auto _ : state) {
+    SatEncoder encoder(config);
+    benchmark::DoNotOptimize(encoder.testEqual(circOne, circTwo, inputs));
+    checks.add(encoder.getStats());
+  }
+  reportStatistics(state, checks);
+}
+
+Configuration withCheck(const EquivalenceCheck check) {
+  Configuration config{};
+  config.equivalenceCheck = check;
+  return config;
+}
+
+Configuration withEncoding(const EncodingType encoding) {
+  Configuration config{};
+  config.encoding = encoding;
+  return config;
+}
+
+// Paper Evaluation: qubits 4 to 128 in steps of 4 at depth 1000
+#define EQUIVALENCE_SWEEP(name, depth, ...)                                    \
+  BENCHMARK_CAPTURE(checkEquivalence, name, __VA_ARGS__)                       \
+      ->ArgsProduct({{4, 8, 12}, {depth}})                                     \
+      ->ArgNames({"qubits", "depth"})                                          \
+      ->Unit(benchmark::kMillisecond)
+
+EQUIVALENCE_SWEEP(MiterEquivalent, 100, true, Configuration{});
+EQUIVALENCE_SWEEP(MiterNonEquivalent, 100, false, Configuration{});
+EQUIVALENCE_SWEEP(DirectNonEquivalent, 100, false,
+                  withCheck(EquivalenceCheck::Direct));
+EQUIVALENCE_SWEEP(UnitaryNonEquivalent, 100, false,
+                  withCheck(EquivalenceCheck::Unitary));
+
+// solve times of the generator encodings. One-hot and order can be solved
+// orders of magnitude slower on deep circuits, so the default ranges stop at
+// depth 25.
+#define ENCODING_SWEEP(name, ...)                                              \
+  BENCHMARK_CAPTURE(checkEquivalence, name, __VA_ARGS__)                       \
+      ->ArgsProduct({{2, 8, 32}, {5, 25}})                                     \
+      ->ArgNames({"qubits", "depth"})                                          \
+      ->Unit(benchmark::kMillisecond)
+
+ENCODING_SWEEP(BinaryEquivalent, true, withEncoding(EncodingType::Binary));
+ENCODING_SWEEP(BinaryNonEquivalent, false, withEncoding(EncodingType::Binary));
+ENCODING_SWEEP(OneHotEquivalent, true, withEncoding(EncodingType::OneHot));
+ENCODING_SWEEP(OneHotNonEquivalent, false, withEncoding(EncodingType::OneHot));
+ENCODING_SWEEP(OrderEquivalent, true, withEncoding(EncodingType::Order));
+ENCODING_SWEEP(OrderNonEquivalent, false, withEncoding(EncodingType::Order));
+} // namespace
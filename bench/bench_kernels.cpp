@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+// Microbenchmarks of the hot paths of the preprocessing and the encoding: the
+// tableau gate kernels, the interning of generators and the construction of
+// the constraints of the generator mappings.
+
+#include "CliffordKernels.hpp"
+#include "CnfBuilder.hpp"
+#include "GeneratorEncoding.hpp"
+#include "GeneratorTable.hpp"
+#include "Tableau.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// seed of every benchmark, so that all runs measure the same work
+constexpr std::uint32_t SEED = 42U;
+
+// tableau after a random sequence of H, S and CNOT gates
+Tableau scrambledTableau(const std::size_t nrOfQubits, std::mt19937& gen) {
+  Tableau                                    tableau(nrOfQubits);
+  std::uniform_int_distribution<std::size_t> qubit(0U, nrOfQubits - 1U);
+  for (std::size_t i = 0U; i < 4U * nrOfQubits; i++) {
+    const auto target = qubit(gen);
+    switch (gen() % 3U) {
+    case 0U:
+      tableau.applyH(target);
+      break;
+    case 1U:
+      tableau.applyS(target);
+      break;
+    default:
+      if (const auto control = qubit(gen); control != target) {
+        tableau.applyCNOT(control, target);
+      }
+      break;
+    }
+  }
+  return tableau;
+}
+
+enum class Gate : std::uint8_t { H, S, CNOT, Clifford };
+
+// one gate on every qubit of the tableau per iteration, with the kernels of
+// the given instruction set
+void applyGates(benchmark::State& state, const CliffordKernels::Isa isa,
+                const Gate gate) {
+  const auto   nrOfQubits = static_cast<std::size_t>(state.range(0));
+  std::mt19937 gen(SEED);
+  auto         tableau = scrambledTableau(nrOfQubits, gen);
+  tableau.setKernels(CliffordKernels::get(isa));
+  const auto sh = SingleQubitClifford::s().then(SingleQubitClifford::h());
+  for (auto _ : state) {
+    for (std::size_t q = 0U; q < nrOfQubits; q++) {
+      switch (gate) {
+      case Gate::H:
+        tableau.applyH(q);
+        break;
+      case Gate::S:
+        tableau.applyS(q);
+        break;
+      case Gate::CNOT:
+        tableau.applyCNOT(q, (q + 1U) % nrOfQubits);
+        break;
+      case Gate::Clifford:
+        tableau.applyClifford(q, sh);
+        break;
+      }
+    }
+    benchmark::DoNotOptimize(tableau.raw().data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(nrOfQubits));
+  state.SetLabel(CliffordKernels::get(isa).name);
+}
+
+// the fingerprint of a tableau is refreshed lazily, i.e., once per level
+void BM_TableauFingerprint(benchmark::State& state) {
+  const auto   nrOfQubits = static_cast<std::size_t>(state.range(0));
+  std::mt19937 gen(SEED);
+  auto         tableau = scrambledTableau(nrOfQubits, gen);
+  for (auto _ : state) {
+    tableau.applyH(0U);
+    benchmark::DoNotOptimize(tableau.fingerprint());
+  }
+}
+BENCHMARK(BM_TableauFingerprint)->RangeMultiplier(4)->Range(16, 1024);
+
+// every iteration interns a fresh set of tableaus, half of them twice
+void BM_GeneratorTableIntern(benchmark::State& state) {
+  const auto   nrOfQubits     = static_cast<std::size_t>(state.range(0));
+  const auto   nrOfGenerators = static_cast<std::size_t>(state.range(1));
+  std::mt19937 gen(SEED);
+  std::vector<Tableau> tableaus;
+  tableaus.reserve(nrOfGenerators);
+  for (std::size_t i = 0U; i < nrOfGenerators; i++) {
+    tableaus.emplace_back(i % 2U == 0U || tableaus.empty()
+                              ? scrambledTableau(nrOfQubits, gen)
+                              : tableaus.back());
+    static_cast<void>(tableaus.back().fingerprint());
+  }
+  for (auto _ : state) {
+    GeneratorTable table{};
+    for (const auto& tableau : tableaus) {
+      benchmark::DoNotOptimize(table.intern(tableau));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(nrOfGenerators));
+}
+BENCHMARK(BM_GeneratorTableIntern)
+    ->ArgsProduct({{8, 64, 256}, {64, 1024}})
+    ->ArgNames({"qubits", "generators"});
+
+// looking up generators that are all interned, as done for most states
+void BM_GeneratorTableFind(benchmark::State& state) {
+  const auto     nrOfQubits     = static_cast<std::size_t>(state.range(0));
+  const auto     nrOfGenerators = static_cast<std::size_t>(state.range(1));
+  std::mt19937   gen(SEED);
+  GeneratorTable table{};
+  std::vector<Tableau> tableaus;
+  for (std::size_t i = 0U; i < nrOfGenerators; i++) {
+    tableaus.emplace_back(scrambledTableau(nrOfQubits, gen));
+    table.intern(tableaus.back());
+  }
+  for (auto _ : state) {
+    for (const auto& tableau : tableaus) {
+      benchmark::DoNotOptimize(table.find(tableau));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(nrOfGenerators));
+}
+BENCHMARK(BM_GeneratorTableFind)
+    ->ArgsProduct({{8, 64, 256}, {64, 1024}})
+    ->ArgNames({"qubits", "generators"});
+
+// the implications of random generator mappings of a circuit, as built by
+// SatEncoder::constructSatInstance
+void BM_BuildConstraints(benchmark::State& state, const EncodingType type) {
+  const auto   nrOfGenerators = static_cast<std::size_t>(state.range(0));
+  const auto   depth          = static_cast<std::size_t>(state.range(1));
+  std::mt19937 gen(SEED);
+  std::uniform_int_distribution<std::size_t> id(0U, nrOfGenerators - 1U);
+  std::vector<std::vector<std::pair<std::size_t, std::size_t>>> mappings(
+      depth);
+  for (auto& mapping : mappings) {
+    for (std::size_t i = 0U; i < 8U; i++) {
+      mapping.emplace_back(id(gen), id(gen));
+    }
+  }
+  const GeneratorEncoding encoding(type, nrOfGenerators);
+  std::size_t             clauses = 0U;
+  for (auto _ : state) {
+    CnfBuilder                                    cnf{};
+    std::vector<std::vector<CnfBuilder::Literal>> vars;
+    vars.reserve(depth + 1U);
+    for (std::size_t k = 0U; k <= depth; k++) {
+      vars.emplace_back(encoding.newLevel(cnf));
+    }
+    for (std::size_t k = 0U; k < depth; k++) {
+      for (const auto& [from, to] : mappings[k]) {
+        cnf.addImplication(encoding.equals(vars[k], from),
+                           encoding.equals(vars[k + 1U], to));
+      }
+    }
+    clauses = cnf.clauses();
+    benchmark::DoNotOptimize(cnf.literals().data());
+  }
+  state.counters["clauses"] = static_cast<double>(clauses);
+  state.SetLabel(toString(type));
+}
+BENCHMARK_CAPTURE(BM_BuildConstraints, Binary, EncodingType::Binary)
+    ->ArgsProduct({{64, 1024}, {10, 100}})
+    ->ArgNames({"generators", "depth"});
+BENCHMARK_CAPTURE(BM_BuildConstraints, OneHot, EncodingType::OneHot)
+    ->ArgsProduct({{64, 1024}, {10, 100}})
+    ->ArgNames({"generators", "depth"});
+BENCHMARK_CAPTURE(BM_BuildConstraints, Order, EncodingType::Order)
+    ->ArgsProduct({{64, 1024}, {10, 100}})
+    ->ArgNames({"generators", "depth"});
+
+// every gate kernel of every instruction set available on this CPU
+const bool KERNELS_REGISTERED = [] {
+  const std::vector<std::pair<Gate, std::string>> gates{
+      {Gate::H, "H"},
+      {Gate::S, "S"},
+      {Gate::CNOT, "CNOT"},
+      {Gate::Clifford, "Clifford"}};
+  for (const auto isa : CliffordKernels::available()) {
+    for (const auto& [gate, name] : gates) {
+      benchmark::RegisterBenchmark(
+          ("BM_Tableau" + name + "/" + CliffordKernels::get(isa).name).c_str(),
+          [isa = isa, gate = gate](benchmark::State& state) {
+            applyGates(state, isa, gate);
+          })
+          ->RangeMultiplier(4)
+          ->Range(16, 1024);
+    }
+  }
+  return true;
+}();
+} // namespace
@@ -0,0 +1,120 @@
+# Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+# Copyright (c) 2025 Munich Quantum Software Company GmbH
+# All rights reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Licensed under the MIT License
+
+# /// script
+# requires-python = ">=3.9"
+# ///
+"""Compare two runs of the benchmarks and flag regressions.
+
+Both files are written by the ``qusat_bench`` executable with ``--benchmark_format=json`` or
+``--benchmark_out=<file>``. Benchmarks that were run with repetitions are compared by their median.
+The script exits with a non-zero status if any benchmark is slower than the threshold allows.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import statistics
+import sys
+from pathlib import Path
+
+NANOSECONDS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load_times(path: Path, metric: str) -> dict[str, float]:
+    """Return the time in nanoseconds of every benchmark of a run.
+
+    Args:
+        path: The JSON output of Google Benchmark.
+        metric: Either ``real_time`` or ``cpu_time``.
+
+    Returns:
+        The median of the aggregates if the benchmark was repeated, else the mean of its runs, by benchmark name.
+    """
+    with path.open(encoding="utf-8") as file:
+        benchmarks = json.load(file)["benchmarks"]
+
+    runs: dict[str, list[float]] = {}
+    medians: dict[str, float] = {}
+    for benchmark in benchmarks:
+        if benchmark.get("error_occurred", False):
+            continue
+        name = benchmark.get("run_name", benchmark["name"])
+        time = benchmark[metric] * NANOSECONDS[benchmark.get("time_unit", "ns")]
+        if benchmark.get("run_type") == "aggregate":
+            if benchmark.get("aggregate_name") == "median":
+                medians[name] = time
+        else:
+            runs.setdefault(name, []).append(time)
+    times = {name: statistics.fmean(values) for name, values in runs.items()}
+    times.update(medians)
+    return times
+
+
+def compare(baseline: dict[str, float], contender: dict[str, float], threshold: float) -> list[str]:
+    """Print the change of every benchmark of both runs.
+
+    Args:
+        baseline: The times of the stored baseline.
+        contender: The times of the new run.
+        threshold: The relative slowdown that is tolerated, e.g., 0.1 for 10%.
+
+    Returns:
+        The names of the benchmarks that regressed.
+    """
+    regressions = []
+    width = max((len(name) for name in baseline), default=0)
+    for name in sorted(baseline.keys() & contender.keys()):
+        change = contender[name] / baseline[name] - 1.0 if baseline[name] > 0.0 else 0.0
+        regressed = change > threshold
+        if regressed:
+            regressions.append(name)
+        sys.stdout.write(
+            f"{name:<{width}}  {baseline[name]:>14.0f} ns  {contender[name]:>14.0f} ns  {change:>+8.1%}"
+            f"{'  REGRESSION' if regressed else ''}\n"
+        )
+    for name in sorted(baseline.keys() - contender.keys()):
+        sys.stdout.write(f"{name:<{width}}  missing in the contender\n")
+    return regressions
+
+
+def main() -> int:
+    """Compare the runs given on the command line.
+
+    Returns:
+        The exit status, 1 if any benchmark regressed.
+    """
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline", type=Path, help="JSON output of the baseline run")
+    parser.add_argument("contender", type=Path, help="JSON output of the run to check")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=10.0,
+        help="tolerated slowdown in percent before a benchmark counts as regressed (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--metric",
+        choices=["real_time", "cpu_time"],
+        default="cpu_time",
+        help="time that is compared (default: %(default)s)",
+    )
+    args = parser.parse_args()
+
+    regressions = compare(
+        load_times(args.baseline, args.metric), load_times(args.contender, args.metric), args.threshold / 100.0
+    )
+    if regressions:
+        sys.stdout.write(f"{len(regressions)} benchmark(s) regressed by more than {args.threshold}%\n")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -14,6 +14,12 @@ set(FETCH_PACKAGES "")
 # search for Z3
 find_package(Z3 REQUIRED)
 
+# threads for the parallel preprocessing
+find_package(Threads REQUIRED)
+
+# zlib for gzip-compressed DIMACS files, which are unavailable without it
+find_package(ZLIB)
+
 if(BUILD_MQT_QUSAT_BINDINGS)
   # Manually detect the installed mqt-core package.
   execute_process(
@@ -70,6 +76,19 @@ if(BUILD_MQT_QUSAT_TESTS)
   list(APPEND FETCH_PACKAGES googletest)
 endif()
 
+if(BUILD_MQT_QUSAT_BENCHMARKS)
+  set(BENCHMARK_ENABLE_TESTING
+      OFF
+      CACHE BOOL "" FORCE)
+  set(BENCHMARK_VERSION
+      1.9.4
+      CACHE STRING "Google Benchmark version")
+  set(BENCHMARK_URL
+      https://github.com/google/benchmark/archive/refs/tags/v${BENCHMARK_VERSION}.tar.gz)
+  FetchContent_Declare(benchmark URL ${BENCHMARK_URL} FIND_PACKAGE_ARGS ${BENCHMARK_VERSION})
+  list(APPEND FETCH_PACKAGES benchmark)
+endif()
+
 if(BUILD_MQT_QUSAT_BINDINGS)
   # add pybind11_json library
   FetchContent_Declare(
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/// contents of a file in the binary format
+enum class BinaryKind : std::uint64_t {
+  Circuits = 1U, // preprocessed circuits, see SatEncoder::preprocess
+  Cnf      = 2U  // clause database, see CnfBuilder::writeBinary
+};
+
+/**
+ * Versioned binary format for data that is too large for JSON or DIMACS, e.g.,
+ * to preprocess circuits in one process and solve them in another.
+ *
+ * A file is a header (magic, version, byte order mark, kind) followed by a
+ * sequence of 64-bit words in native byte order. The words are written in
+ * chunks of at most CHUNK_WORDS words, each framed by its size and a checksum,
+ * and an empty chunk ends the file. Writer and reader therefore only ever hold
+ * one chunk in memory, and truncated or corrupted files are detected by the
+ * reader instead of being decoded. Readers should not reserve memory for the
+ * counts they read, a corrupted count then fails once the file ends instead of
+ * allocating for it.
+ */
+class BinaryWriter {
+public:
+  /// version of the format, files of other versions are rejected
+  static constexpr std::uint64_t VERSION     = 2U;
+  static constexpr std::size_t   CHUNK_WORDS = std::size_t{1} << 13U;
+
+  /// writes the header of a file of the given kind
+  BinaryWriter(std::ostream& stream, BinaryKind kind);
+
+  void write(std::uint64_t word);
+  void write(const std::uint64_t* words, std::size_t count);
+  /// length followed by the characters, padded to whole words
+  void write(const std::string& text);
+
+  /**
+   * Writes the pending words and the end of the file. Nothing may be written
+   * afterwards.
+   * @throws std::runtime_error if the stream failed
+   */
+  void finish();
+
+private:
+  void flush();
+
+  std::ostream&              os;
+  std::vector<std::uint64_t> chunk;
+};
+
+class BinaryReader {
+public:
+  /**
+   * Reads the header of a file of the given kind.
+   * @throws std::runtime_error if the stream holds no file of this kind and
+   * version in the byte order of this machine
+   */
+  BinaryReader(std::istream& stream, BinaryKind kind);
+
+  /// @throws std::runtime_error if the file is truncated, corrupted or ended
+  std::uint64_t read();
+  void          read(std::uint64_t* words, std::size_t count);
+  [[nodiscard]] std::string readString();
+
+  /// whether all words have been read, i.e., the end of the file follows
+  [[nodiscard]] bool atEnd();
+
+private:
+  // loads the next chunk, returns false at the end of the file
+  bool fill();
+
+  std::istream&              is;
+  std::vector<std::uint64_t> chunk;
+  std::size_t                pos   = 0U;
+  bool                       ended = false;
+};
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/**
+ * Cooperative cancellation of running checks. Copies of a token share their
+ * state, so a check can be cancelled from any thread that holds a copy of the
+ * token it was given. Checks poll the token between levels and during
+ * solving, solvers that cannot poll subscribe a callback that interrupts
+ * them instead.
+ */
+class CancellationToken {
+  struct State {
+    std::atomic<bool>                            cancelled{false};
+    std::mutex                                   mutex;
+    std::map<std::size_t, std::function<void()>> callbacks;
+    std::size_t                                  nextId = 0U;
+  };
+
+public:
+  /// removes its callback from the token once destroyed
+  class Subscription {
+  public:
+    Subscription() = default;
+    Subscription(std::shared_ptr<State> tokenState, std::size_t callbackId)
+        : state(std::move(tokenState)), id(callbackId) {}
+    ~Subscription();
+
+    Subscription(const Subscription&)            = delete;
+    Subscription& operator=(const Subscription&) = delete;
+
+  private:
+    std::shared_ptr<State> state;
+    std::size_t            id = 0U;
+  };
+
+  CancellationToken() : state(std::make_shared<State>()) {}
+
+  /// requests the cancellation of all checks that use the token
+  void cancel() const;
+
+  [[nodiscard]] bool cancelled() const {
+    return state->cancelled.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Calls the callback once the token is cancelled, right away if it already
+   * is. The callback is called on the cancelling thread and is never called
+   * after the subscription has been destroyed.
+   */
+  [[nodiscard]] std::unique_ptr<Subscription>
+  subscribe(std::function<void()> callback) const;
+
+private:
+  std::shared_ptr<State> state;
+};
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "SatBackend.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * Compact conflict-driven clause learning solver in the style of MiniSat:
+ * two watched literals with blocking literals, first-UIP learning with clause
+ * minimization, VSIDS branching with phase saving, Luby restarts, and
+ * activity-based reduction of the learnt clauses. Assumptions are decided
+ * first, so the solver can be used incrementally.
+ */
+class CdclSolver final : public SatBackend {
+public:
+  void      addClause(const Literal* first, const Literal* last) override;
+  void      assume(Literal literal) override;
+  SatResult solve() override;
+
+  [[nodiscard]] bool value(Literal literal) const override;
+  [[nodiscard]] std::map<std::string, double> statistics() const override;
+  [[nodiscard]] SatBackendType type() const override {
+    return SatBackendType::CDCL;
+  }
+
+  [[nodiscard]] std::size_t variables() const { return assigns.size(); }
+
+private:
+  // internal literal: 2 * variable + sign, with 0-based variables
+  using Lit = std::uint32_t;
+
+  static constexpr std::uint32_t NO_CLAUSE =
+      std::numeric_limits<std::uint32_t>::max();
+
+  static constexpr std::uint8_t FALSE_VALUE = 0U;
+  static constexpr std::uint8_t TRUE_VALUE  = 1U;
+  static constexpr std::uint8_t UNDEF_VALUE = 2U;
+
+  struct Clause {
+    std::vector<Lit> lits;
+    double           activity = 0.;
+    bool             learnt   = false;
+  };
+  struct Watcher {
+    std::uint32_t clause;
+    Lit           blocker;
+  };
+
+  static Lit toLit(Literal literal);
+
+  [[nodiscard]] std::uint8_t litValue(const Lit lit) const {
+    const auto value = assigns[lit >> 1U];
+    return value == UNDEF_VALUE ? UNDEF_VALUE
+                                : static_cast<std::uint8_t>(value ^ (lit & 1U));
+  }
+  [[nodiscard]] std::uint32_t decisionLevel() const {
+    return static_cast<std::uint32_t>(trailLimits.size());
+  }
+
+  void          ensureVariable(std::uint32_t var);
+  void          enqueue(Lit lit, std::uint32_t reason);
+  std::uint32_t propagate();
+  void          analyze(std::uint32_t conflict, std::vector<Lit>& learnt,
+                        std::uint32_t& backtrackLevel);
+  void          backtrack(std::uint32_t level);
+  std::uint32_t attach(std::vector<Lit> lits, bool learnt);
+  void          reduceLearnts();
+  SatResult     search();
+
+  // approximate size of the clause database and the variable data in bytes
+  [[nodiscard]] std::size_t memoryUsage() const;
+  // records the first limit that has been reached in stopped, if any
+  bool reachedLimit();
+
+  // VSIDS
+  void          bumpVariable(std::uint32_t var);
+  void          bumpClause(Clause& clause);
+  void          heapInsert(std::uint32_t var);
+  void          heapUp(std::size_t pos);
+  void          heapDown(std::size_t pos);
+  std::uint32_t heapPop();
+
+  std::vector<Clause>               clauses;
+  std::vector<std::vector<Watcher>> watches;
+  std::vector<std::uint8_t>         assigns;
+  std::vector<std::uint32_t>        levels;
+  std::vector<std::uint32_t>        reasons;
+  std::vector<bool>                 polarity;
+  std::vector<std::uint8_t>         seen;
+  std::vector<Lit>                  trail;
+  std::vector<std::size_t>          trailLimits;
+  std::size_t                       propagationHead = 0U;
+
+  std::vector<double>        activity;
+  std::vector<std::uint32_t> heap;
+  std::vector<std::int64_t>  heapIndex; // -1 if not in the heap
+  double                     variableIncrement = 1.;
+  double                     clauseIncrement   = 1.;
+
+  std::vector<Lit>  assumptions;
+  std::vector<bool> model;
+  bool              ok          = true; // false once unsatisfiable
+  std::size_t       nrOfLearnts = 0U;
+  double            maxLearnts  = 0.;
+
+  std::size_t nrOfStoredLiterals      = 0U; // in all clauses
+  std::size_t propagationsBeforeSolve = 0U;
+
+  std::size_t nrOfSolves       = 0U;
+  std::size_t nrOfConflicts    = 0U;
+  std::size_t nrOfDecisions    = 0U;
+  std::size_t nrOfPropagations = 0U;
+  std::size_t nrOfRestarts     = 0U;
+  std::size_t nrOfReductions   = 0U;
+};
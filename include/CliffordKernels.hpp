@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Element of the single-qubit Clifford group modulo global phase (24
+ * elements). An element is described by its action on the x and z bit of a
+ * tableau row:
+ *   x' = (x & xFromX) ^ (z & xFromZ),  z' = (x & zFromX) ^ (z & zFromZ),
+ * and the phase of a row flips if it acts as X, Z, or Y on the qubit and the
+ * corresponding phaseX, phaseZ, or phaseY bit is set. Composition is a lookup
+ * in a precomputed 24 x 24 table, so runs of single-qubit gates on the same
+ * qubit can be fused into one element and applied in a single tableau sweep.
+ */
+class SingleQubitClifford {
+public:
+  static constexpr std::size_t GROUP_ORDER = 24U;
+
+  struct Action {
+    bool xFromX;
+    bool xFromZ;
+    bool zFromX;
+    bool zFromZ;
+    bool phaseX;
+    bool phaseZ;
+    bool phaseY;
+  };
+
+  /// identity element
+  SingleQubitClifford() = default;
+
+  [[nodiscard]] static SingleQubitClifford fromIndex(std::uint8_t index);
+  [[nodiscard]] static SingleQubitClifford h();
+  [[nodiscard]] static SingleQubitClifford s();
+  [[nodiscard]] static SingleQubitClifford sdg();
+  [[nodiscard]] static SingleQubitClifford x();
+  [[nodiscard]] static SingleQubitClifford y();
+  [[nodiscard]] static SingleQubitClifford z();
+  /// square root of X, equal to V up to a global phase
+  [[nodiscard]] static SingleQubitClifford sx();
+  [[nodiscard]] static SingleQubitClifford sxdg();
+
+  /// element that first applies this element and then `next`
+  [[nodiscard]] SingleQubitClifford then(const SingleQubitClifford& next) const;
+
+  [[nodiscard]] const Action& action() const;
+  [[nodiscard]] std::uint8_t  index() const { return idx; }
+  [[nodiscard]] bool          isIdentity() const { return idx == 0U; }
+
+  bool operator==(const SingleQubitClifford& other) const {
+    return idx == other.idx;
+  }
+  bool operator!=(const SingleQubitClifford& other) const {
+    return idx != other.idx;
+  }
+
+private:
+  explicit SingleQubitClifford(const std::uint8_t index) : idx(index) {}
+
+  std::uint8_t idx = 0U;
+};
+
+/**
+ * Word-parallel update kernels for the columns of a bit-packed stabilizer
+ * tableau. Every kernel receives the packed columns of the involved qubits and
+ * the phase column, each `words` 64-bit words long, and updates all rows at
+ * once in a single pass. Vectorized variants are provided for AVX2 and
+ * AVX-512; the variant used by `Tableau` is picked once at runtime from the
+ * features of the CPU.
+ */
+struct CliffordKernels {
+  enum class Isa : std::uint8_t { Scalar, AVX2, AVX512 };
+
+  using SingleQubitKernel = void (*)(std::uint64_t* x, std::uint64_t* z,
+                                     std::uint64_t* r, std::size_t words);
+  using CliffordKernel    = void (*)(std::uint64_t* x, std::uint64_t* z,
+                                  std::uint64_t* r, std::size_t words,
+                                  const SingleQubitClifford& gate);
+  /// the columns of the first qubit (control) precede the ones of the second
+  /// qubit (target)
+  using TwoQubitKernel    = void (*)(std::uint64_t* xc, std::uint64_t* zc,
+                                  std::uint64_t* xt, std::uint64_t* zt,
+                                  std::uint64_t* r, std::size_t words);
+
+  Isa               isa;
+  const char*       name;
+  SingleQubitKernel h;
+  SingleQubitKernel s;
+  SingleQubitKernel sdg;
+  SingleQubitKernel x;
+  SingleQubitKernel y;
+  SingleQubitKernel z;
+  SingleQubitKernel sx;
+  SingleQubitKernel sxdg;
+  CliffordKernel    clifford;
+  TwoQubitKernel    cnot;
+  TwoQubitKernel    cz;
+  TwoQubitKernel    cy;
+  TwoQubitKernel    swap;
+  TwoQubitKernel    iswap;
+  TwoQubitKernel    iswapdg;
+  TwoQubitKernel    dcx; // CNOT from the first qubit, then from the second
+  TwoQubitKernel    ecr; // echoed cross-resonance gate, Qiskit's convention
+
+  /// kernels for the given instruction set (scalar if it is not available)
+  [[nodiscard]] static const CliffordKernels& get(Isa isa);
+
+  /// kernels for the widest instruction set supported by the executing CPU
+  [[nodiscard]] static const CliffordKernels& active();
+
+  /// instruction sets that are compiled in and supported by the executing CPU
+  [[nodiscard]] static std::vector<Isa> available();
+};
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Propositional formula in conjunctive normal form. Literals follow the DIMACS
+ * convention: variable v > 0 is the literal v, its negation is -v. All clauses
+ * are kept in one flat buffer in which every clause is terminated by 0, so
+ * that the instance can be written out or handed to a solver without any
+ * further translation.
+ */
+class CnfBuilder {
+public:
+  using Literal = std::int32_t;
+
+  /// receives the clauses of a builder instead of its buffer, see setSink()
+  class Sink {
+  public:
+    virtual ~Sink() = default;
+
+    /// the literals of the clause, without the terminating 0
+    virtual void addClause(const Literal* first, const Literal* last) = 0;
+  };
+
+  /// creates a fresh variable and returns its positive literal
+  Literal newVariable() { return ++nrOfVariables; }
+
+  /// creates `count` fresh variables, e.g., the bits of a binary number
+  std::vector<Literal> newVariables(std::size_t count);
+
+  void addClause(std::initializer_list<Literal> clause);
+  void addClause(const std::vector<Literal>& clause);
+
+  /**
+   * Literals whose conjunction states that the binary number with the given
+   * bits (least significant bit first) equals the given value.
+   */
+  [[nodiscard]] static std::vector<Literal>
+  equals(const std::vector<Literal>& bits, std::uint64_t value);
+
+  /// adds (/\ premise) -> (/\ conclusion)
+  void addImplication(const std::vector<Literal>& premise,
+                      const std::vector<Literal>& conclusion);
+
+  /// adds the constraint that the binary number `bits` is smaller than `bound`
+  void addLessThan(const std::vector<Literal>& bits, std::uint64_t bound);
+
+  /// adds the constraint that at most one of the literals is true
+  void addAtMostOne(const std::vector<Literal>& lits);
+
+  /// adds the constraint that both binary numbers are equal
+  void addEqual(const std::vector<Literal>& lhs,
+                const std::vector<Literal>& rhs);
+
+  /// adds the constraint that both binary numbers differ in at least one bit
+  void addNotEqual(const std::vector<Literal>& lhs,
+                   const std::vector<Literal>& rhs);
+
+  [[nodiscard]] std::size_t variables() const {
+    return static_cast<std::size_t>(nrOfVariables);
+  }
+  [[nodiscard]] std::size_t clauses() const { return nrOfClauses; }
+
+  /**
+   * Hands all following clauses to the sink as they are added instead of
+   * storing them, e.g., to stream them to a file. Variables and clauses are
+   * still counted. nullptr stores the clauses again.
+   */
+  void setSink(Sink* target) { sink = target; }
+
+  /// all clauses back to back, each terminated by 0
+  [[nodiscard]] const std::vector<Literal>& literals() const {
+    return buffer;
+  }
+
+  /// calls f(first, last) with the literal range of every clause
+  template <class F> void forEachClause(F&& f) const {
+    const auto* begin = buffer.data();
+    const auto* end   = begin + buffer.size();
+    for (const auto* it = begin; it != end; ++it) {
+      const auto* first = it;
+      while (*it != 0) {
+        ++it;
+      }
+      f(first, it);
+    }
+  }
+
+  void writeDIMACS(std::ostream& os) const;
+  [[nodiscard]] std::string toDIMACS() const;
+
+  /**
+   * Writes the clauses in the binary format of BinaryWriter, two literals per
+   * word, without an intermediate copy of the instance.
+   * @throws std::runtime_error if the stream failed
+   */
+  void writeBinary(std::ostream& os) const;
+
+  /**
+   * Reads clauses written by writeBinary() one chunk at a time.
+   * @throws std::runtime_error if the stream holds no valid instance
+   */
+  [[nodiscard]] static CnfBuilder readBinary(std::istream& is);
+
+  void clear();
+
+private:
+  // terminates the clause whose literals start at `begin` of the buffer, or
+  // hands them to the sink and removes them again
+  void endClause(std::size_t begin);
+
+  Literal              nrOfVariables = 0;
+  std::size_t          nrOfClauses   = 0U;
+  std::vector<Literal> buffer;
+  Sink*                sink          = nullptr;
+};
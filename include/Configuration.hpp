@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "GateSource.hpp"
+#include "GeneratorEncoding.hpp"
+#include "SatBackend.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <stdexcept>
+#include <string>
+
+using json = nlohmann::json;
+
+/// how testEqual decides the equivalence of two circuits
+enum class EquivalenceCheck : std::uint8_t {
+  Miter,  // SAT instance over the generator mappings of both circuits
+  Direct, // comparison of the canonical stabilizer groups of the outputs
+  Unitary // comparison of the destabilizer tableaus, independent of inputs
+};
+
+[[nodiscard]] inline std::string toString(const EquivalenceCheck check) {
+  switch (check) {
+  case EquivalenceCheck::Miter:
+    return "miter";
+  case EquivalenceCheck::Direct:
+    return "direct";
+  case EquivalenceCheck::Unitary:
+    return "unitary";
+  }
+  return "unknown";
+}
+
+[[nodiscard]] inline EquivalenceCheck
+equivalenceCheckFromString(const std::string& name) {
+  if (name == "miter") {
+    return EquivalenceCheck::Miter;
+  }
+  if (name == "direct") {
+    return EquivalenceCheck::Direct;
+  }
+  if (name == "unitary") {
+    return EquivalenceCheck::Unitary;
+  }
+  throw std::invalid_argument("Unknown equivalence check: " + name);
+}
+
+/// which levels of a circuit get level variables in the SAT instances
+enum class LevelCompression : std::uint8_t {
+  None,     // every level
+  Identity, // every level that changes some generator
+  Full      // only the input and the output, all levels are composed. A
+            // counterexample then tells the last level of one circuit.
+};
+
+[[nodiscard]] inline std::string toString(const LevelCompression compression) {
+  switch (compression) {
+  case LevelCompression::None:
+    return "none";
+  case LevelCompression::Identity:
+    return "identity";
+  case LevelCompression::Full:
+    return "full";
+  }
+  return "unknown";
+}
+
+[[nodiscard]] inline LevelCompression
+levelCompressionFromString(const std::string& name) {
+  if (name == "none") {
+    return LevelCompression::None;
+  }
+  if (name == "identity") {
+    return LevelCompression::Identity;
+  }
+  if (name == "full") {
+    return LevelCompression::Full;
+  }
+  throw std::invalid_argument("Unknown level compression: " + name);
+}
+
+struct Configuration {
+  // number of threads used to simulate the input states, 0 uses the
+  // process-wide pool of one thread per hardware thread, which all encoders
+  // share, and 1 disables multi-threading
+  std::size_t nThreads = 0U;
+  // simulate the levels that two compared circuits start with only once
+  bool shareCommonPrefix = true;
+  // solver used to decide the constructed instances
+  SatBackendType backend = SatBackendType::Z3;
+  // encoding of the generator id of every level
+  EncodingType encoding = EncodingType::Binary;
+  // decide equivalence with the SAT miter or by comparing the output states
+  EquivalenceCheck equivalenceCheck = EquivalenceCheck::Miter;
+  // validate the verdict of the unitary check with the SAT miter over the same
+  // tableaus, a disagreement throws
+  bool crossCheck = false;
+  // number of levels the streaming front end keeps open before it hands out
+  // the oldest one, bounds its memory for every circuit scheduled as soon as
+  // possible
+  std::size_t streamWindow = 64U;
+  // placement of the gates of a circuit in levels, the fewer levels the fewer
+  // level variables. Circuits read from a GateSource are always scheduled as
+  // soon as possible, as late as possible needs all gates of a circuit at once
+  LevelScheduling levelScheduling = LevelScheduling::AsSoonAsPossible;
+  // compose the generator mappings of consecutive levels as soon as they are
+  // simulated, levels that are composed away are neither kept nor need level
+  // variables
+  LevelCompression levelCompression = LevelCompression::None;
+  // file of a GeneratorCache that simulations are replayed from and stored
+  // to, no cache is used if empty
+  std::string cacheFile;
+  // time limit of a check in milliseconds. The simulation and the solver give
+  // up once it is reached and the check reports a timeout instead of a
+  // verdict. 0 disables the limit
+  std::size_t timeout = 0U;
+  // megabytes the simulation and the solver may allocate each. A check that
+  // exceeds it reports the memory limit instead of a verdict. 0 disables it
+  std::size_t memoryLimit = 0U;
+  // deterministic work limit of the solver, z3's rlimit or the number of
+  // propagations of the CDCL solver. 0 disables it
+  std::size_t resourceLimit = 0U;
+  // record every timed phase of the checks in the statistics, so that they can
+  // be exported with Profile::writeChromeTrace()
+  bool trace = false;
+
+  [[nodiscard]] json to_json() const {
+    return json{{"nThreads", nThreads},
+                {"shareCommonPrefix", shareCommonPrefix},
+                {"backend", ::toString(backend)},
+                {"encoding", ::toString(encoding)},
+                {"equivalenceCheck", ::toString(equivalenceCheck)},
+                {"crossCheck", crossCheck},
+                {"streamWindow", streamWindow},
+                {"levelScheduling", ::toString(levelScheduling)},
+                {"levelCompression", ::toString(levelCompression)},
+                {"cacheFile", cacheFile},
+                {"timeout", timeout},
+                {"memoryLimit", memoryLimit},
+                {"resourceLimit", resourceLimit},
+                {"trace", trace}};
+  }
+
+  void from_json(const json& j) {
+    j.at("nThreads").get_to(nThreads);
+    j.at("shareCommonPrefix").get_to(shareCommonPrefix);
+    backend          = satBackendFromString(j.at("backend").get<std::string>());
+    encoding         = encodingFromString(j.at("encoding").get<std::string>());
+    equivalenceCheck = equivalenceCheckFromString(
+        j.at("equivalenceCheck").get<std::string>());
+    j.at("crossCheck").get_to(crossCheck);
+    j.at("streamWindow").get_to(streamWindow);
+    levelScheduling = levelSchedulingFromString(
+        j.at("levelScheduling").get<std::string>());
+    levelCompression = levelCompressionFromString(
+        j.at("levelCompression").get<std::string>());
+    j.at("cacheFile").get_to(cacheFile);
+    j.at("timeout").get_to(timeout);
+    j.at("memoryLimit").get_to(memoryLimit);
+    j.at("resourceLimit").get_to(resourceLimit);
+    j.at("trace").get_to(trace);
+  }
+
+  [[nodiscard]] std::string toString() const { return to_json().dump(2); }
+};
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "CnfBuilder.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * Streams a CNF in the DIMACS format to a file or a file descriptor,
+ * optionally gzip-compressed. Clauses are formatted into a buffer of
+ * BUFFER_BYTES that is written out whenever it is full, so the memory of the
+ * writer does not grow with the instance.
+ *
+ * A DIMACS file starts with comment lines and the problem line, which holds
+ * the numbers of variables and clauses. Both therefore have to be known before
+ * the first clause is written, see SatEncoder::writeDIMACS for an instance
+ * that is counted in a first pass and streamed in a second one.
+ */
+class DimacsWriter : public CnfBuilder::Sink {
+public:
+  static constexpr std::size_t BUFFER_BYTES = std::size_t{1} << 16U;
+
+  /**
+   * Creates or truncates the file at the given path.
+   * @throws std::runtime_error if the file cannot be opened, or if gzip is
+   * requested but not supported
+   */
+  DimacsWriter(const std::string& path, bool gzip);
+
+  /**
+   * Writes to the given file descriptor, e.g., a pipe to a solver, which is
+   * neither closed nor seeked.
+   * @throws std::runtime_error if gzip is requested but not supported
+   */
+  DimacsWriter(int fd, bool gzip);
+
+  /// finishes the file if finish() has not been called, ignoring errors
+  ~DimacsWriter() override;
+
+  DimacsWriter(const DimacsWriter&)            = delete;
+  DimacsWriter& operator=(const DimacsWriter&) = delete;
+
+  /// whether qusat was built with zlib, i.e., can write gzip-compressed files
+  [[nodiscard]] static bool gzipSupported();
+
+  /// writes the text as comment lines, which have to precede the problem line
+  void comment(const std::string& text);
+
+  /// writes the problem line, which has to precede the clauses
+  void problem(std::size_t variables, std::size_t clauses);
+
+  void addClause(const CnfBuilder::Literal* first,
+                 const CnfBuilder::Literal* last) override;
+
+  /**
+   * Writes all buffered output and closes the compressed stream.
+   * @throws std::runtime_error if writing failed, or if another number of
+   * clauses than announced by the problem line has been written
+   */
+  void finish();
+
+  [[nodiscard]] std::size_t clauses() const { return written; }
+
+private:
+  void put(const char* data, std::size_t size);
+  void flush();
+
+  int               fd        = -1;
+  bool              ownsFd    = false;
+  void*             gz        = nullptr; // gzFile if compressed
+  bool              failed    = false;
+  bool              done      = false;
+  bool              started   = false; // problem line written
+  std::size_t       announced = 0U;
+  std::size_t       written   = 0U;
+  std::vector<char> buffer;
+};
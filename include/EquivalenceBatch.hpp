@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "CancellationToken.hpp"
+#include "Configuration.hpp"
+#include "SatEncoder.hpp"
+#include "Statistics.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/// equivalence check of one pair of circuits in a batch
+struct EquivalenceJob {
+  qc::QuantumComputation* circuitOne = nullptr;
+  qc::QuantumComputation* circuitTwo = nullptr;
+  // input states in the notation of SatEncoder::testEqual, the all-zero state
+  // if empty
+  std::vector<std::string> inputs;
+  // time limit of the job in milliseconds, 0 uses Configuration::timeout
+  std::size_t timeout = 0U;
+};
+
+struct EquivalenceResult {
+  bool        equivalent = false;
+  Statistics  stats;
+  std::string error; // why the job could not be checked, empty otherwise
+};
+
+/**
+ * Equivalence checks of many pairs of circuits, run on a worker pool.
+ *
+ * Every distinct circuit, identified by its address, is validated once. Jobs
+ * with the same inputs form a group whose distinct circuits are simulated
+ * together, once, by one encoder. Every job then gets its own encoder with
+ * only the generators of its two circuits, so its instance is the same as
+ * that of a separate check, and decides its equivalence with the configured
+ * check. The shared preprocessing is reported in the statistics of
+ * every job of the group.
+ *
+ * The time limit of a job starts with the simulation of its group and bounds
+ * the simulation and its decision, a job that reaches it reports the timeout
+ * in its statistics. The shared simulation is stopped once the largest time
+ * limit of the jobs of its group has passed. The memory limit and the
+ * cancellation token also stop the shared simulation, in which case all jobs
+ * of the group report the interruption.
+ * Configuration::nThreads sets the number of workers, 0 runs the batch on the
+ * process-wide ThreadPool::shared(). Groups and jobs are spread across the
+ * workers, and the encoders of the groups simulate their input states on the
+ * same workers.
+ */
+class EquivalenceBatch {
+public:
+  explicit EquivalenceBatch(const Configuration& config = {});
+
+  /**
+   * Checks all jobs. Jobs that cannot be checked, e.g., because a circuit is
+   * not a Clifford circuit, report why in their result instead of throwing.
+   * @return the result of every job, in the order of the jobs
+   */
+  std::vector<EquivalenceResult> run(const std::vector<EquivalenceJob>& jobs);
+
+  /// lets the jobs of the following runs be cancelled through the token
+  void setCancellationToken(const CancellationToken& token) {
+    cancellation = token;
+  }
+
+private:
+  // encoder of a job, holding the generators of the given circuits of the
+  // group with ids renumbered from 0, inputs first
+  static std::unique_ptr<SatEncoder>
+  forkEncoder(const SatEncoder&                               group,
+              std::vector<SatEncoder::CircuitRepresentation>& representations);
+
+  Configuration               configuration;
+  std::shared_ptr<ThreadPool> pool; // shared with the encoders of the batch
+  std::optional<CancellationToken> cancellation;
+};
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "CancellationToken.hpp"
+#include "CnfBuilder.hpp"
+#include "Configuration.hpp"
+#include "SatBackend.hpp"
+#include "SatEncoder.hpp"
+#include "Statistics.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Equivalence checks of one pair of circuits for many sets of input states.
+ *
+ * The circuits are simulated for all candidate inputs and the miter over their
+ * generator mappings is handed to the solver once. Every input generator gets
+ * a selector variable that forces the common input of the miter to be that
+ * generator, and one clause requires some selector to hold. A query disables
+ * the selectors of the inputs it does not contain through assumptions, so the
+ * solver, including its learned clauses, is kept from one query to the next.
+ *
+ * The backend and the encoding are taken from the configuration, the
+ * equivalence check is always the miter.
+ */
+class EquivalenceSession {
+public:
+  /**
+   * Simulates both circuits for all candidate inputs and builds the miter.
+   * @param circuitOne first circuit
+   * @param circuitTwo second circuit
+   * @param inputs candidate input states, in the notation of
+   * SatEncoder::testEqual. If empty, the all-zero state is the only candidate.
+   * @param configuration configuration of the underlying encoder
+   * @throws std::runtime_error if the configured memory limit is reached
+   * during the simulation
+   */
+  EquivalenceSession(qc::QuantumComputation&         circuitOne,
+                     qc::QuantumComputation&         circuitTwo,
+                     const std::vector<std::string>& inputs,
+                     const Configuration&            configuration = {});
+
+  /**
+   * Checks the circuits for the candidate inputs with the given indices.
+   * @return true if the circuits are equivalent for all of these inputs. A
+   * query that reaches a configured limit or is cancelled returns false and
+   * reports the interruption in the statistics.
+   */
+  bool testEqual(const std::vector<std::size_t>& inputs);
+
+  /**
+   * Checks the circuits for the given inputs, all of which must be among the
+   * candidates.
+   * @return true if the circuits are equivalent for all of these inputs
+   */
+  bool testEqual(const std::vector<std::string>& inputs);
+
+  /// checks the circuits for all candidate inputs
+  bool testEqual();
+
+  /// lets the following queries be cancelled through the token
+  void setCancellationToken(const CancellationToken& token) {
+    encoder.setCancellationToken(token);
+  }
+
+  [[nodiscard]] std::size_t nrOfInputs() const { return candidates.size(); }
+
+  /// statistics of the construction and of the last query
+  [[nodiscard]] const Statistics& getStats() const { return encoder.stats; }
+
+private:
+  SatEncoder                                     encoder;
+  std::vector<std::string>                       candidates;
+  std::vector<SatEncoder::CircuitRepresentation> representations;
+  // selector variable of every input generator
+  std::vector<CnfBuilder::Literal> selectors;
+  std::unique_ptr<SatBackend>      solver;
+};
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+/// Clifford gates that act on two targets instead of a control and a target
+[[nodiscard]] inline bool isTwoTargetClifford(const qc::OpType type) {
+  return type == qc::OpType::SWAP || type == qc::OpType::iSWAP ||
+         type == qc::OpType::iSWAPdg || type == qc::OpType::DCX ||
+         type == qc::OpType::ECR;
+}
+
+/// single Clifford gate as applied to the tableaus
+struct CliffordGate {
+  qc::OpType    type;
+  unsigned long target;
+  unsigned long control; // control, or first target of a two-target gate,
+                         // only meaningful if twoQubit()
+  bool          controlled;
+
+  /// whether the gate acts on `control` as well
+  [[nodiscard]] bool twoQubit() const {
+    return controlled || isTwoTargetClifford(type);
+  }
+
+  bool operator==(const CliffordGate& other) const {
+    return type == other.type && target == other.target &&
+           controlled == other.controlled &&
+           (!twoQubit() || control == other.control);
+  }
+};
+
+/**
+ * Source of the gates of a circuit, read one at a time in program order.
+ * Sources only hold what they need to produce the next gate, so a circuit can
+ * be processed without ever being materialized.
+ */
+class GateSource {
+public:
+  virtual ~GateSource() = default;
+
+  [[nodiscard]] virtual std::size_t qubits() const = 0;
+
+  /**
+   * Reads the next gate.
+   * @return the gate, or std::nullopt at the end of the circuit
+   * @throws std::invalid_argument if the gate is not a supported Clifford gate
+   */
+  virtual std::optional<CliffordGate> next() = 0;
+};
+
+/// gates of a QuantumComputation, read through its iterator
+class CircuitGateSource : public GateSource {
+public:
+  explicit CircuitGateSource(const qc::QuantumComputation& circuit)
+      : nrOfQubits(circuit.getNqubits()), current(circuit.begin()),
+        last(circuit.end()) {}
+
+  /**
+   * Whether the operation is a supported Clifford gate: I, H, S, Sdg, X, Y,
+   * Z, SX, SXdg, V and Vdg, X, Y and Z with a single positive control, and
+   * SWAP, iSWAP, iSWAPdg, DCX and ECR.
+   */
+  [[nodiscard]] static bool isSupported(const qc::Operation& op);
+
+  /// converts a supported Clifford operation
+  /// @throws std::invalid_argument if the operation is not supported
+  [[nodiscard]] static CliffordGate toGate(const qc::Operation& op);
+
+  [[nodiscard]] std::size_t   qubits() const override { return nrOfQubits; }
+  std::optional<CliffordGate> next() override;
+
+private:
+  using Iterator = std::vector<std::unique_ptr<qc::Operation>>::const_iterator;
+
+  std::size_t nrOfQubits;
+  Iterator    current;
+  Iterator    last;
+};
+
+/**
+ * Gates of an OpenQASM 2 or 3 program, parsed statement by statement. The
+ * register declarations are read up front, everything after them is only read
+ * when the respective gate is requested. Supported are the gates id, h, s,
+ * sdg, x, y, z, sx, sxdg, cx, cy, cz, swap, iswap, iswapdg, dcx and ecr, also
+ * broadcast over whole registers, as well as barriers, which are skipped.
+ * Classical registers are ignored, all other statements are rejected.
+ */
+class QasmGateSource : public GateSource {
+public:
+  /// reads the program from the file at the given path
+  explicit QasmGateSource(const std::string& path);
+  /// reads the program from the given stream, which must outlive the source
+  explicit QasmGateSource(std::istream& stream);
+
+  [[nodiscard]] std::size_t   qubits() const override { return nrOfQubits; }
+  std::optional<CliffordGate> next() override;
+
+private:
+  struct Register {
+    std::size_t offset;
+    std::size_t size;
+  };
+
+  void readDeclarations();
+  // next statement without its terminating semicolon, empty at the end
+  std::string readStatement();
+  // handles a declaration, returns false if the statement is none
+  bool declare(const std::string& statement);
+  // expands the operand into the qubits it addresses
+  [[nodiscard]] std::vector<std::size_t>
+  operandQubits(const std::string& operand) const;
+  void expand(const std::string& statement);
+
+  std::ifstream                   file;
+  std::istream*                   in;
+  std::map<std::string, Register> registers;
+  std::size_t                     nrOfQubits = 0U;
+  std::string                     lookahead; // first statement after the
+                                             // declarations
+  std::deque<CliffordGate> pending; // gates of a broadcast statement
+};
+
+/// where the gates of a circuit are placed when its levels are formed
+enum class LevelScheduling : std::uint8_t {
+  AsSoonAsPossible, // every gate in the first level it can be placed in
+  AsLateAsPossible  // every gate in the last level it can be placed in
+};
+
+[[nodiscard]] std::string toString(LevelScheduling scheduling);
+[[nodiscard]] LevelScheduling
+levelSchedulingFromString(const std::string& name);
+
+/**
+ * Places gates in levels as soon as possible. The gates of a level act on
+ * distinct qubits, and a gate is placed after every earlier gate it does not
+ * commute with. Gates commute if both are diagonal on every qubit they share,
+ * e.g., Z, S, Sdg, CZ and the control of a CNOT, so a diagonal gate may fill
+ * a gap that an earlier level left on its qubit.
+ *
+ * Every qubit keeps the level after its last non-diagonal gate and the levels
+ * taken by diagonal gates since, so memory grows with the number of qubits and
+ * the diagonal gates in flight instead of the number of gates.
+ */
+class LevelScheduler {
+public:
+  explicit LevelScheduler(std::size_t qubits);
+
+  /// first level not before `from` that the gate can be placed in
+  [[nodiscard]] std::size_t earliest(const CliffordGate& gate,
+                                     std::size_t         from) const;
+
+  /// places the gate in the level, which has to be free for it
+  void place(const CliffordGate& gate, std::size_t level);
+
+  /// levels before `level` are closed and no longer have to be tracked
+  void close(std::size_t level) { closed = level; }
+
+  [[nodiscard]] std::size_t qubits() const { return state.size(); }
+
+  /// whether the gate leaves the computational basis states of the qubit
+  /// unchanged up to a phase, the qubit has to be one the gate acts on
+  [[nodiscard]] static bool diagonal(const CliffordGate& gate,
+                                     std::size_t         qubit);
+
+private:
+  struct Qubit {
+    std::size_t              barrier = 0U; // level after the last non-diagonal
+                                           // gate
+    std::size_t              end     = 0U; // level after the last gate
+    std::vector<std::size_t> diagonals;    // sorted levels of diagonal gates
+                                           // from the barrier on
+  };
+
+  // first level the gate can be placed in with respect to the qubit alone
+  [[nodiscard]] std::size_t lowest(const CliffordGate& gate,
+                                   std::size_t         qubit) const;
+  // whether a diagonal gate on the qubit has been placed in the level
+  [[nodiscard]] bool taken(std::size_t qubit, std::size_t level) const;
+
+  std::vector<Qubit> state;
+  std::size_t        closed = 0U;
+};
+
+/**
+ * Forms the levels of the gates, given in program order, with a
+ * LevelScheduler. As late as possible starts from the levels as soon as
+ * possible and moves every gate, the last one first, to the last level it can
+ * reach without passing a gate it does not commute with, which keeps the depth
+ * but moves gates towards the output. Identity gates are dropped.
+ * @throws std::invalid_argument if a gate acts on a qubit beyond the circuit
+ */
+[[nodiscard]] std::vector<std::vector<CliffordGate>>
+scheduleLevels(const std::vector<CliffordGate>& gates, std::size_t qubits,
+               LevelScheduling scheduling);
+
+/**
+ * Forms the levels of a streamed circuit as soon as possible with a
+ * LevelScheduler, so the gates of a level act on distinct qubits and every
+ * gate follows the earlier ones it does not commute with.
+ *
+ * At most `window` levels are kept open. Once a gate would be placed beyond
+ * them, the oldest open level is handed out and no gate is placed in it
+ * afterwards, so memory is bounded by the window and the number of qubits
+ * instead of the number of gates.
+ */
+class LevelStream {
+public:
+  LevelStream(GateSource& gateSource, std::size_t levelWindow);
+
+  /**
+   * Moves the gates of the next level into `level`.
+   * @return false once all levels have been handed out
+   */
+  bool next(std::vector<CliffordGate>& level);
+
+  /// number of gates read from the source so far
+  [[nodiscard]] std::size_t gates() const { return nrOfGates; }
+
+private:
+  void pop(std::vector<CliffordGate>& level);
+
+  GateSource&                           source;
+  std::size_t                           window;
+  LevelScheduler                        scheduler;
+  std::deque<std::vector<CliffordGate>> open;     // levels base, base + 1, ...
+  std::size_t                           base = 0U;
+  std::optional<CliffordGate>           pending;
+  bool                                  exhausted = false;
+  std::size_t                           nrOfGates = 0U;
+};
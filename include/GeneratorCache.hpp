@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "GateSource.hpp"
+#include "GeneratorTable.hpp"
+#include "Tableau.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Persistent cache of simulated circuits, shared across runs and processes.
+ *
+ * The cache file is a header followed by an append-only sequence of records.
+ * Every record holds the simulation of one circuit for one set of inputs: the
+ * key of the input tableaus, one key per level that identifies the gates of
+ * all levels up to it, the generator of every input after every level, and
+ * the packed words of these generators. A run that starts with the same
+ * inputs and levels as a record replays it instead of simulating, and only
+ * simulates from the first level the record does not cover.
+ *
+ * The file is memory-mapped when the cache is opened, records appended later
+ * are only seen by caches opened afterwards. Every record starts with a
+ * marker and carries a checksum of its contents, so records that were torn by
+ * a crash, or are still being written by another process, fail the check and
+ * are skipped, and the records after them are still found. Appending takes an
+ * exclusive lock on the file and never changes existing bytes, so any number
+ * of processes may read the file while it is extended. Without mmap (on
+ * Windows), the file is read into memory instead and appends are not locked.
+ */
+class GeneratorCache {
+public:
+  /// version of the file format, files of other versions are not used
+  static constexpr std::uint32_t VERSION = 1U;
+
+  using Key = Fingerprint;
+
+  /// view of a record inside the mapped file
+  class Record {
+  public:
+    [[nodiscard]] std::size_t qubits() const { return data[0]; }
+    [[nodiscard]] std::size_t rows() const { return data[1]; }
+    [[nodiscard]] std::size_t inputs() const { return data[4]; }
+    [[nodiscard]] std::size_t levels() const { return data[5]; }
+
+    /// key of the gates of levels 0, ..., level
+    [[nodiscard]] Key levelKey(std::size_t level) const;
+
+    /// packed words of the generator of the input after the given number of
+    /// levels, 0 being the input itself
+    [[nodiscard]] const std::uint64_t* generator(std::size_t levels,
+                                                 std::size_t input) const;
+
+  private:
+    friend class GeneratorCache;
+    explicit Record(const std::uint64_t* payload) : data(payload) {}
+
+    const std::uint64_t* data;
+  };
+
+  /**
+   * Opens the cache file at the given path, creating it if it does not exist.
+   * @throws std::runtime_error if the file cannot be opened
+   */
+  explicit GeneratorCache(const std::string& path);
+  ~GeneratorCache();
+
+  GeneratorCache(const GeneratorCache&)            = delete;
+  GeneratorCache& operator=(const GeneratorCache&) = delete;
+
+  /// whether the file has the supported version, otherwise nothing is read or
+  /// written
+  [[nodiscard]] bool usable() const { return compatible; }
+
+  /// key of the given input tableaus, in order
+  [[nodiscard]] static Key inputKey(const std::vector<const Tableau*>& inputs);
+
+  /// key of the levels up to the given one, extending the key of the levels
+  /// before it
+  [[nodiscard]] static Key levelKey(const Key&                       previous,
+                                    const std::vector<CliffordGate>& level);
+
+  /**
+   * Records of the given inputs, i.e., whose inputs key and input tableaus
+   * match exactly.
+   */
+  [[nodiscard]] std::vector<Record>
+  find(const Key& key, const std::vector<const Tableau*>& inputs) const;
+
+  /**
+   * Appends the simulation of a circuit.
+   * @param key key of the input tableaus
+   * @param levelKeys key of every level
+   * @param chains chains[i][l] is the id in `table` of the generator of input
+   * i after l levels
+   * @param table table holding the generators
+   */
+  void store(const Key& key, const std::vector<Key>& levelKeys,
+             const std::vector<std::vector<std::size_t>>& chains,
+             const GeneratorTable&                        table);
+
+  /// number of valid records in the mapped part of the file
+  [[nodiscard]] std::size_t size() const { return records.size(); }
+
+private:
+  void mapFile();
+  void indexRecords();
+
+  std::string path;
+  int         fd = -1;
+  bool        compatible = false;
+  // the mapped file, or its contents read into memory without mmap
+  const std::uint64_t*       base = nullptr;
+  std::size_t                mappedWords = 0U;
+  std::vector<std::uint64_t> contents;
+  // offset of the payload of every valid record, by the low word of its key
+  std::unordered_multimap<std::uint64_t, std::size_t> records;
+};
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "CnfBuilder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/// ways to encode the generator id of a level in propositional variables
+enum class EncodingType : std::uint8_t {
+  Binary, // ceil(log2(G)) bits, ids >= G are blocked if G is no power of two
+  OneHot, // one variable per id, exactly one of them is true
+  Order   // G - 1 ladder variables y_k = (id >= k) with y_{k+1} -> y_k
+};
+
+[[nodiscard]] std::string  toString(EncodingType type);
+[[nodiscard]] EncodingType encodingFromString(const std::string& name);
+
+/**
+ * Encoding of the level variables of a SAT instance, i.e., of numbers in
+ * [0, G) for G generators. All constraints between level variables that the
+ * instances need are expressed through this class, so that the encodings are
+ * interchangeable.
+ */
+class GeneratorEncoding {
+public:
+  using Literal = CnfBuilder::Literal;
+
+  /**
+   * @param encoding encoding to use
+   * @param nrOfGenerators number of generators G
+   */
+  GeneratorEncoding(EncodingType encoding, std::size_t nrOfGenerators);
+
+  [[nodiscard]] EncodingType type() const { return encoding; }
+
+  /// creates the variables of a new level together with their domain
+  /// constraints
+  std::vector<Literal> newLevel(CnfBuilder& cnf) const;
+
+  /// literals whose conjunction states that the level holds the given id
+  [[nodiscard]] std::vector<Literal> equals(const std::vector<Literal>& level,
+                                            std::size_t id) const;
+
+  /// adds the constraint that the id of the level is smaller than `bound`
+  void addLessThan(CnfBuilder& cnf, const std::vector<Literal>& level,
+                   std::size_t bound) const;
+
+  /// adds the constraint that both levels hold the same id
+  void addEqual(CnfBuilder& cnf, const std::vector<Literal>& lhs,
+                const std::vector<Literal>& rhs) const;
+
+  /// adds the constraint that the levels hold different ids
+  void addNotEqual(CnfBuilder& cnf, const std::vector<Literal>& lhs,
+                   const std::vector<Literal>& rhs) const;
+
+private:
+  EncodingType encoding;
+  std::size_t  generators;
+  std::size_t  bitwidth = 0U; // only used by the binary encoding
+};
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Tableau.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * Interning table that assigns consecutive ids to distinct stabilizer
+ * tableaus. Lookups are keyed by the incrementally maintained fingerprint of
+ * the tableau, the packed words are only compared in full if fingerprints
+ * collide, and only tableaus that are new are stored.
+ *
+ * All generators are kept once, back to back in a single arena of packed words
+ * (x columns, z columns, phases), and are addressed by their id.
+ */
+class GeneratorTable {
+public:
+  /**
+   * Looks up the given tableau and adds it if it has not been seen before.
+   * @param tableau tableau to intern
+   * @return id of the tableau and whether it has been newly added
+   */
+  std::pair<std::size_t, bool> intern(const Tableau& tableau);
+
+  /**
+   * Looks up the given tableau without adding it. Lookups do not modify the
+   * table and may run concurrently with each other, but not with intern().
+   * @param tableau tableau to look up
+   * @return id of the tableau if it has been interned before
+   */
+  [[nodiscard]] std::optional<std::size_t> find(const Tableau& tableau) const;
+
+  [[nodiscard]] std::size_t size() const { return slots.size(); }
+  [[nodiscard]] bool        empty() const { return slots.empty(); }
+
+  /// approximate number of bytes allocated by the table
+  [[nodiscard]] std::size_t bytes() const {
+    return (arena.capacity() * sizeof(std::uint64_t)) +
+           (slots.capacity() * sizeof(Slot)) +
+           (index.size() * (sizeof(Fingerprint) + (3U * sizeof(void*)))) +
+           (index.bucket_count() * sizeof(void*));
+  }
+
+  /**
+   * Packed words of the generator with the given id. The pointer is
+   * invalidated by the next call to intern().
+   */
+  [[nodiscard]] const std::uint64_t* words(const std::size_t id) const {
+    return arena.data() + slots.at(id).offset;
+  }
+  [[nodiscard]] std::size_t wordCount(const std::size_t id) const {
+    return slots.at(id).size;
+  }
+  [[nodiscard]] std::size_t qubits(const std::size_t id) const {
+    return slots.at(id).qubits;
+  }
+  [[nodiscard]] std::size_t rows(const std::size_t id) const {
+    return slots.at(id).rows;
+  }
+
+  /// unpacks the generator with the given id into the matrix [x | z | r]
+  [[nodiscard]] std::vector<std::vector<bool>>
+  toGenerator(std::size_t id) const;
+
+  void clear();
+
+private:
+  struct Slot {
+    std::size_t offset;
+    std::size_t size;
+    std::size_t qubits;
+    std::size_t rows;
+  };
+
+  std::unordered_multimap<Fingerprint, std::size_t, FingerprintHash> index;
+  std::vector<Slot>                                                  slots;
+  std::vector<std::uint64_t>                                         arena;
+};
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+// set to 0 to compile the instrumentation of the hot paths out, see
+// QUSAT_PROFILE_PHASE and QUSAT_PROFILE_COUNT
+#ifndef QUSAT_PROFILING
+#define QUSAT_PROFILING 1
+#endif
+
+using json = nlohmann::json;
+
+/// phases of a check whose time is measured
+enum class ProfilePhase : std::uint8_t {
+  DagConstruction,    // levels formed from the gates of the circuits
+  Simulation,         // gates applied to the tableaus
+  Interning,          // new generators added to the generator table
+  ConstraintBuilding, // CNF of the SAT instance
+  Solving             // SAT solver or comparison of the output states
+};
+constexpr std::size_t NR_OF_PROFILE_PHASES = 5U;
+
+/// events of a check that are counted
+enum class ProfileCounter : std::uint8_t {
+  GatesApplied,    // gates applied to a single tableau
+  InterningHits,   // tableaus that had been interned before
+  InterningMisses, // tableaus that were added as new generators
+  BytesAllocated   // growth of the generator table and the CNF
+};
+constexpr std::size_t NR_OF_PROFILE_COUNTERS = 4U;
+
+[[nodiscard]] std::string toString(ProfilePhase phase);
+[[nodiscard]] std::string toString(ProfileCounter counter);
+
+/**
+ * Nanosecond times of the phases of the checks and counters of their hot
+ * paths. If tracing is enabled, every timed span is recorded as well and can be
+ * exported in the Chrome trace event format, e.g., for chrome://tracing or
+ * Perfetto.
+ *
+ * A profile is not synchronized. Spans are only timed on the thread that runs
+ * the check, parallel sections are timed as a whole.
+ */
+class Profile {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Span {
+    ProfilePhase      phase;
+    Clock::time_point start;
+    Clock::duration   duration;
+    std::uint64_t     thread; // hash of the id of the timing thread
+  };
+
+  void addTime(ProfilePhase phase, Clock::time_point start,
+               Clock::time_point end);
+  void count(const ProfileCounter counter, const std::uint64_t amount) {
+    counters[static_cast<std::size_t>(counter)] += amount;
+  }
+
+  [[nodiscard]] std::uint64_t nanoseconds(const ProfilePhase phase) const {
+    return phases[static_cast<std::size_t>(phase)];
+  }
+  [[nodiscard]] std::uint64_t value(const ProfileCounter counter) const {
+    return counters[static_cast<std::size_t>(counter)];
+  }
+
+  /// records every following span until disabled
+  void setTracing(const bool enabled) { tracing = enabled; }
+  [[nodiscard]] const std::vector<Span>& spans() const { return trace; }
+
+  [[nodiscard]] json to_json() const;
+  void               from_json(const json& j);
+
+  /**
+   * The recorded spans as complete events and the counters as counter events
+   * in the Chrome trace event format, with times in microseconds.
+   */
+  [[nodiscard]] json toChromeTrace() const;
+
+  /// @throws std::runtime_error if the file cannot be written
+  void writeChromeTrace(const std::string& path) const;
+
+private:
+  std::array<std::uint64_t, NR_OF_PROFILE_PHASES>   phases{};
+  std::array<std::uint64_t, NR_OF_PROFILE_COUNTERS> counters{};
+  bool                                              tracing = false;
+  std::vector<Span>                                 trace;
+};
+
+/// adds the time from its construction to its destruction to the profile
+class PhaseTimer {
+public:
+  PhaseTimer(Profile& target, const ProfilePhase timedPhase)
+      : profile(target), phase(timedPhase), start(Profile::Clock::now()) {}
+  ~PhaseTimer() { profile.addTime(phase, start, Profile::Clock::now()); }
+
+  PhaseTimer(const PhaseTimer&)            = delete;
+  PhaseTimer& operator=(const PhaseTimer&) = delete;
+
+private:
+  Profile&                   profile;
+  ProfilePhase               phase;
+  Profile::Clock::time_point start;
+};
+
+#define QUSAT_PROFILE_CONCAT_IMPL(a, b) a##b
+#define QUSAT_PROFILE_CONCAT(a, b)      QUSAT_PROFILE_CONCAT_IMPL(a, b)
+
+#if QUSAT_PROFILING
+// times the rest of the enclosing scope as the given phase
+#define QUSAT_PROFILE_PHASE(profile, phase)                                    \
+  const PhaseTimer QUSAT_PROFILE_CONCAT(qusatPhaseTimer, __LINE__)(profile,    \
+                                                                   phase)
+// adds the amount to the counter, the amount is not evaluated if compiled out
+#define QUSAT_PROFILE_COUNT(profile, counter, amount)                          \
+  (profile).count(counter, amount)
+#else
+#define QUSAT_PROFILE_PHASE(profile, phase)           static_cast<void>(0)
+#define QUSAT_PROFILE_COUNT(profile, counter, amount) static_cast<void>(0)
+#endif
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "CancellationToken.hpp"
+#include "CnfBuilder.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+
+enum class SatResult : std::uint8_t { Satisfiable, Unsatisfiable, Unknown };
+
+/// why a check stopped without a verdict
+enum class Interruption : std::uint8_t {
+  None,
+  Timeout,       // the wall-clock time limit was reached
+  MemoryLimit,   // the memory limit was reached
+  ResourceLimit, // the deterministic resource limit was reached
+  Cancelled      // the cancellation token was cancelled
+};
+
+[[nodiscard]] std::string  toString(Interruption interruption);
+[[nodiscard]] Interruption interruptionFromString(const std::string& name);
+
+/// bounds of the calls to SatBackend::solve(), all unbounded by default
+struct SolverLimits {
+  std::optional<std::chrono::steady_clock::time_point> deadline;
+  // megabytes the solver may allocate, 0 for no limit
+  std::size_t memoryLimit = 0U;
+  // z3's rlimit, the number of propagations for the CDCL solver, 0 for no
+  // limit. Unlike the deadline, the limit gives reproducible results.
+  std::size_t resourceLimit = 0U;
+  std::optional<CancellationToken> cancellation;
+};
+
+/// available SAT solvers
+enum class SatBackendType : std::uint8_t {
+  Z3,  // z3's solver on the clauses as propositional formulas
+  CDCL // in-process CDCL solver, see CdclSolver
+};
+
+[[nodiscard]] std::string    toString(SatBackendType type);
+[[nodiscard]] SatBackendType satBackendFromString(const std::string& name);
+
+/**
+ * Incremental SAT solver working on DIMACS literals. Clauses stay in the
+ * solver across calls to solve(), assumptions only hold for the next call.
+ */
+class SatBackend {
+public:
+  using Literal = CnfBuilder::Literal;
+
+  virtual ~SatBackend() = default;
+
+  /// creates a backend of the given type
+  [[nodiscard]] static std::unique_ptr<SatBackend> create(SatBackendType type);
+
+  /// adds the clause consisting of the literals in [first, last)
+  virtual void addClause(const Literal* first, const Literal* last) = 0;
+
+  /// adds all clauses of the given formula
+  void addCnf(const CnfBuilder& cnf) {
+    cnf.forEachClause([this](const Literal* first, const Literal* last) {
+      addClause(first, last);
+    });
+  }
+
+  /// assumes the literal to be true during the next call to solve()
+  virtual void assume(Literal literal) = 0;
+
+  virtual SatResult solve() = 0;
+
+  /**
+   * Bounds every following call to solve(), which gives up with
+   * SatResult::Unknown once one of the limits is reached.
+   */
+  void setLimits(const SolverLimits& solverLimits) { limits = solverLimits; }
+
+  /// limit that made the last call to solve() return SatResult::Unknown
+  [[nodiscard]] Interruption interruption() const { return stopped; }
+
+  /// value of the literal in the model found by the last satisfiable solve()
+  [[nodiscard]] virtual bool value(Literal literal) const = 0;
+
+  /// solver specific statistics of all calls to solve() so far
+  [[nodiscard]] virtual std::map<std::string, double> statistics() const = 0;
+
+  [[nodiscard]] virtual SatBackendType type() const = 0;
+
+protected:
+  // cancellation or deadline, whichever has been reached first. The memory
+  // and resource limits are checked by the solvers themselves.
+  [[nodiscard]] Interruption pollLimits() const {
+    if (limits.cancellation.has_value() && limits.cancellation->cancelled()) {
+      return Interruption::Cancelled;
+    }
+    if (limits.deadline.has_value() &&
+        std::chrono::steady_clock::now() >= *limits.deadline) {
+      return Interruption::Timeout;
+    }
+    return Interruption::None;
+  }
+
+  SolverLimits limits;
+  Interruption stopped = Interruption::None;
+};
@@ -10,29 +10,58 @@
 
 #pragma once
 
+#include "CancellationToken.hpp"
+#include "CnfBuilder.hpp"
+#include "Configuration.hpp"
+#include "DimacsWriter.hpp"
+#include "GateSource.hpp"
+#include "GeneratorCache.hpp"
+#include "GeneratorTable.hpp"
+#include "SatBackend.hpp"
 #include "Statistics.hpp"
-#include "circuit_optimizer/CircuitOptimizer.hpp"
+#include "Tableau.hpp"
+#include "ThreadPool.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <functional>
+#include <istream>
 #include <map>
+#include <memory>
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
 #include <string>
 #include <vector>
-#include <z3++.h>
 
 using json = nlohmann::json;
 
 class SatEncoder {
 public:
+  SatEncoder() = default;
+  explicit SatEncoder(const Configuration& config) : configuration(config) {
+    stats.profile.setTracing(config.trace);
+  }
+
   /**
    * Takes two Clifford circuits, constructs SAT instance and checks if there is
-   * an assignment that leads to outputs that differ.
+   * an assignment that leads to outputs that differ. With
+   * EquivalenceCheck::Direct, the output states of both circuits are compared
+   * directly instead, which needs no solver and treats different tableaus of
+   * the same state as equal. EquivalenceCheck::Unitary ignores the inputs and
+   * compares the full destabilizer tableaus, i.e., the circuits as operators
+   * up to global phase. The gates are read through a CircuitGateSource and
+   * leveled while they are simulated, as for the streaming variants below,
+   * unless Configuration::levelScheduling places them as late as possible.
    * @param circuit first circuit
    * @param circuitTwo second circuit
    * @param inputs input states to consider. In stabilizer representation, e.g.
    * ZZ == |00>. If empty all-zero state is assumed.
-   * @return true if the circuits are equivalent (for given inputs)
+   * @return true if the circuits are equivalent (for given inputs). If a
+   * configured limit is reached or the check is cancelled first, false is
+   * returned and the statistics report the interruption.
    */
   bool testEqual(qc::QuantumComputation&         circuit,
                  qc::QuantumComputation&         circuitTwo,
@@ -67,62 +96,248 @@ public:
   bool checkSatisfiability(qc::QuantumComputation& circuitOne);
 
   /**
-   * Output the DIMACS CNF representation from Z3 of the given circuit.
+   * Output the DIMACS CNF representation of the given circuit.
    * @param circuit circuit to construct SAT instance for
    * @return The DIMACS CNF representation of circuit
+   * @throws std::runtime_error if a configured limit is reached or the
+   * encoder is cancelled during the simulation
    */
   std::string generateDIMACS(qc::QuantumComputation& circuit);
 
+  /**
+   * Streaming variants of the checks above. The gates are read one at a time
+   * and grouped into levels by a LevelStream, so neither the circuits nor
+   * their DAGs are ever materialized and memory only grows with the number of
+   * qubits, the unique generators and the generator mappings. The levels are
+   * always formed as soon as possible, as scheduling them as late as possible
+   * would require the whole circuit. Like the check above, testEqual()
+   * returns false if the sources act on different numbers of qubits or one
+   * of them is empty, which is only known once it has been read.
+   * @throws std::invalid_argument if a source contains an unsupported gate
+   */
+  bool testEqual(GateSource& circuit, GateSource& circuitTwo,
+                 const std::vector<std::string>& inputs);
+  bool checkSatisfiability(GateSource&                     circuit,
+                           const std::vector<std::string>& inputs);
+  std::string generateDIMACS(GateSource& circuit);
+
+  /**
+   * Writes the DIMACS CNF representation of the circuit to the writer while
+   * the clauses are built, so the instance is never held in memory. Comment
+   * lines ahead of the problem line name the encoding and list the variables
+   * of every level and the generator ids of the inputs and outputs. As the
+   * problem line precedes the clauses, the instance is built twice, first to
+   * count its clauses, but the circuit is only simulated once.
+   * @throws std::runtime_error if a configured limit is reached or the
+   * encoder is cancelled during the simulation, or if writing fails
+   */
+  void writeDIMACS(qc::QuantumComputation& circuit, DimacsWriter& writer);
+  void writeDIMACS(GateSource& circuit, DimacsWriter& writer);
+
+  /**
+   * Simulates the circuits for the given inputs like the checks above, but
+   * writes the result in the binary format of BinaryWriter instead of
+   * deciding it: the inputs, the interned generators and the generator
+   * mappings of every level that the configured level compression keeps,
+   * each with the level it ends at. checkSatisfiability() (one circuit) or
+   * testEqual() (two circuits) on the written stream then decide the
+   * circuits without simulating them again, e.g., in another process or on
+   * another machine. For EquivalenceCheck::Unitary, two circuits are
+   * simulated on the identity tableau instead of the inputs.
+   * @throws std::invalid_argument if a circuit is not a Clifford circuit
+   * @throws std::runtime_error if a configured limit is reached or the
+   * encoder is cancelled during the simulation, or if the stream fails
+   */
+  void preprocess(qc::QuantumComputation&         circuit,
+                  const std::vector<std::string>& inputs, std::ostream& os);
+  void preprocess(qc::QuantumComputation&         circuit,
+                  qc::QuantumComputation&         circuitTwo,
+                  const std::vector<std::string>& inputs, std::ostream& os);
+
+  /**
+   * Decides circuits written by preprocess() with the configuration of this
+   * encoder, which replaces its generators with the ones of the stream.
+   * @throws std::runtime_error if the stream holds no valid preprocessed
+   * circuits
+   * @throws std::invalid_argument if the stream holds another number of
+   * circuits, or circuits simulated for another kind of check
+   */
+  bool testEqual(std::istream& preprocessed);
+  bool checkSatisfiability(std::istream& preprocessed);
+
+  /**
+   * Binary counterpart of generateDIMACS(), the clauses are streamed in the
+   * format of CnfBuilder::writeBinary().
+   */
+  void writeSatInstance(qc::QuantumComputation& circuit, std::ostream& os);
+
+  /**
+   * Lets the following checks be cancelled through the token, e.g., from
+   * another thread. Cancelled checks return false and report the cancellation
+   * in the statistics.
+   */
+  void setCancellationToken(const CancellationToken& token) {
+    cancellation = token;
+  }
+
   [[nodiscard]] json              to_json() const { return stats.to_json(); }
   [[nodiscard]] const Statistics& getStats() const;
+  [[nodiscard]] const Configuration& getConfiguration() const {
+    return configuration;
+  }
 
 private:
+  friend class EquivalenceBatch;
+  friend class EquivalenceSession;
+
+  // thrown when a check has to stop before its verdict
+  class Interrupted : public std::runtime_error {
+  public:
+    explicit Interrupted(const Interruption why)
+        : std::runtime_error("Check interrupted: " + ::toString(why)),
+          reason(why) {}
+
+    Interruption reason;
+  };
+
   struct QState {
-    unsigned long                  n;
-    std::vector<std::vector<bool>> x;
-    std::vector<std::vector<bool>> z;
-    std::vector<int>               r;
-    std::size_t                    prevGenId;
-
-    [[nodiscard]] std::vector<std::vector<bool>> getLevelGenerator() const;
-    void applyCNOT(unsigned long control, unsigned long target);
-    void applyH(unsigned long target);
-    void applyS(unsigned long target);
+    Tableau     tableau; // bit-packed, column-major stabilizer tableau
+    std::size_t prevGenId = 0U;
   };
 
+  // single gate of a level, applied through the tableau kernels
+  using LevelGate = CliffordGate;
+
+  // moves the gates of the next level of a circuit into its argument, returns
+  // false once the circuit has no more levels
+  using LevelSupplier = std::function<bool(std::vector<LevelGate>&)>;
+
   class CircuitRepresentation {
   public:
     std::vector<std::map<std::size_t, std::size_t>>
         generatorMappings; // list of generatorId <> generatorId maps. One map
-                           // per level
-    std::map<std::size_t, std::vector<std::vector<bool>>>
-        idGeneratorMap; // id <> generator map
+                           // per kept level. The ids address `generators`.
+    std::vector<std::size_t>
+        levelIndex; // level of the circuit after which each mapping ends,
+                    // levels composed into it precede it
+    std::vector<std::size_t>
+        inputGenerators; // id of the initial generator of every input state
+    std::vector<std::size_t>
+        outputGenerators; // id of the final generator of every input state
+    std::size_t levels = 0U; // levels of the circuit, including those that
+                             // the level compression composed away
   };
 
-  std::map<std::vector<std::vector<bool>>, std::size_t>
-      generators; // generator <> id map for reverse lookup
+  GeneratorTable generators; // arena of the interned generators of all
+                             // representations
 
   static QState initializeState(unsigned long      nrOfInputs,
                                 const std::string& input);
 
   static bool isClifford(const qc::QuantumComputation& qc);
 
+  static void applyGate(QState& state, const LevelGate& gate);
+
+  // calls body(i) for every input state i, spread across the thread pool
+  void forEachState(std::size_t                             nrOfStates,
+                    const std::function<void(std::size_t)>& body);
+
   CircuitRepresentation
-  preprocessCircuit(const qc::CircuitOptimizer::DAG& dag,
-                    const std::vector<std::string>&  inputs);
-
-  void constructSatInstance(
-      const CircuitRepresentation& circuitRepresentation,
-      z3::solver& solver); // construct z3 instance. Assumes prepocessCircuit()
-                           // has been run before.
-  void constructMiterInstance(
+  preprocessCircuit(const qc::QuantumComputation&   circuit,
+                    const std::vector<std::string>& inputs);
+
+  // first input for which the circuits produce different output states,
+  // decided by comparing canonical stabilizer groups instead of a SAT instance
+  std::optional<std::size_t>
+  firstDifferingOutput(const CircuitRepresentation& circOneRep,
+                       const CircuitRepresentation& circTwoRep);
+
+  // stores the input that distinguishes both circuits and the first level
+  // after which their generators differ for it in the statistics
+  void recordCounterexample(const CircuitRepresentation&    circOneRep,
+                            const CircuitRepresentation&    circTwoRep,
+                            const std::vector<std::string>& inputs,
+                            std::size_t                     input);
+
+  // simulates all circuits level by level in lockstep for the given inputs,
+  // or on the identity tableau with destabilizers if unitary is set. The
+  // levels are formed from the gates of the circuits while they are simulated,
+  // streamed as for a GateSource unless they are scheduled as late as possible
+  std::vector<CircuitRepresentation>
+  preprocessCircuits(const std::vector<const qc::QuantumComputation*>& circuits,
+                     const std::vector<std::string>& inputs, bool unitary);
+
+  // same for circuits whose levels are pulled one at a time from the
+  // suppliers. Levels found in the configured cache are replayed from it, and
+  // circuits that were simulated are stored to it afterwards. The mapping of
+  // every level is compressed as configured once it is complete.
+  std::vector<CircuitRepresentation>
+  preprocessLevels(std::vector<LevelSupplier>&     circuits,
+                   const std::vector<std::size_t>& qubits,
+                   const std::vector<std::string>& inputs, bool unitary);
+
+  // writes the preprocessed circuits and the generators in the binary format
+  void writeRepresentations(
+      const std::vector<CircuitRepresentation>& representations,
+      const std::vector<std::string>& inputs, bool unitary,
+      std::ostream& os) const;
+
+  // streams the instance of constructSatInstance() with its metadata
+  void writeDIMACS(const CircuitRepresentation& representation,
+                   DimacsWriter&                writer);
+
+  // reads circuits written by writeRepresentations() into the generators
+  std::vector<CircuitRepresentation>
+  readRepresentations(std::istream& is, std::size_t nrOfCircuits,
+                      bool unitary, std::vector<std::string>& inputs);
+
+  // decides the equivalence of the preprocessed circuits with the configured
+  // check
+  bool decideEquivalence(
+      const std::vector<CircuitRepresentation>& representations,
+      const std::vector<std::string>&           inputs);
+
+  // appends the mapping of the given level, dropped or composed into the last
+  // mapping of the representation as the compression allows
+  static void appendLevel(CircuitRepresentation&               representation,
+                          std::map<std::size_t, std::size_t>&& layer,
+                          std::size_t                          level,
+                          LevelCompression                     compression);
+
+  // construct CNF instance. Assumes prepocessCircuit() has been run before.
+  // Returns the variables of every level.
+  std::vector<std::vector<CnfBuilder::Literal>>
+  constructSatInstance(const CircuitRepresentation& circuitRepresentation,
+                       CnfBuilder&                  cnf);
+  // assumes preprocess circuit has been run before. Returns for every input
+  // generator the literals whose conjunction selects it as the common input.
+  std::vector<std::vector<CnfBuilder::Literal>> constructMiterInstance(
       const CircuitRepresentation& circuitOneRepresentation,
-      const CircuitRepresentation& circuitTwoRepresentation,
-      z3::solver& solver); // assumes preprocess circuit has been run before
+      const CircuitRepresentation& circuitTwoRepresentation, CnfBuilder& cnf);
+
+  // starts the configured time limit of a check and clears its interruption
+  void armLimits();
+
+  // limit of the check that has been reached, checked between levels
+  [[nodiscard]] Interruption pollLimits() const;
+
+  // records the interruption of the check, which has no verdict
+  bool giveUp(Interruption reason);
+
+  // limits of the solver of a check
+  [[nodiscard]] SolverLimits solverLimits() const;
 
-  bool isSatisfiable(z3::solver& solver);
+  // calls onModel with the solver if the instance is satisfiable. The solver
+  // gives up once a limit is reached, which is recorded in the statistics
+  bool isSatisfiable(
+      const CnfBuilder&                              cnf,
+      const std::function<void(const SatBackend&)>& onModel = nullptr);
 
-  Statistics  stats;
-  std::size_t nrOfInputGenerators = 0U;
-  std::size_t uniqueGenCnt        = 0U;
+  Configuration                   configuration;
+  Statistics                      stats;
+  std::size_t                     nrOfInputGenerators = 0U;
+  std::shared_ptr<ThreadPool>     pool;  // created on first use, or shared
+  std::unique_ptr<GeneratorCache> cache; // opened on first use if configured
+  std::optional<std::chrono::steady_clock::time_point> deadline; // of a check
+  std::optional<CancellationToken>                     cancellation;
 };
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "Tableau.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Stabilizer group of a state in canonical form.
+ *
+ * Different tableaus may describe the same state, e.g., CNOT maps the rows
+ * Z_0, Z_1 of |00> to Z_0, Z_0 Z_1. The group they generate is unique, though,
+ * and so is the reduced row echelon form of its generator matrix over GF(2)
+ * with the x columns before the z columns. Eliminating with rowsum keeps the
+ * phases of the rows, so two states are equal iff their canonical groups are.
+ *
+ * The rows are stored row-major in 64-bit words, the x bits of a row followed
+ * by its z bits, so that multiplying two rows is a word-wide sweep.
+ */
+class StabilizerGroup {
+public:
+  StabilizerGroup() = default;
+
+  /// canonical group of the state described by the tableau
+  explicit StabilizerGroup(const Tableau& tableau);
+
+  /**
+   * Canonical group of a tableau given by its packed column-major words, e.g.,
+   * as stored in a GeneratorTable. Only the last n rows, the stabilizers, are
+   * taken into account.
+   * @param words x columns, z columns, and phases of the tableau
+   * @param nrOfQubits number of qubits n of the tableau
+   * @param nrOfRows number of rows of the tableau, n or 2n
+   */
+  StabilizerGroup(const std::uint64_t* words, std::size_t nrOfQubits,
+                  std::size_t nrOfRows);
+
+  [[nodiscard]] std::size_t qubits() const { return n; }
+
+  [[nodiscard]] bool x(std::size_t row, std::size_t qubit) const;
+  [[nodiscard]] bool z(std::size_t row, std::size_t qubit) const;
+  [[nodiscard]] bool r(std::size_t row) const { return phases[row] != 0U; }
+
+  bool operator==(const StabilizerGroup& other) const {
+    return n == other.n && data == other.data && phases == other.phases;
+  }
+  bool operator!=(const StabilizerGroup& other) const {
+    return !(*this == other);
+  }
+
+private:
+  [[nodiscard]] std::uint64_t* xWords(const std::size_t row) {
+    return data.data() + (2U * row * nrOfWords);
+  }
+  [[nodiscard]] std::uint64_t* zWords(const std::size_t row) {
+    return data.data() + (((2U * row) + 1U) * nrOfWords);
+  }
+  [[nodiscard]] bool pivot(std::size_t row, std::size_t column) const;
+
+  /// multiplies row `source` into row `target` (rowsum of Aaronson-Gottesman)
+  void rowsum(std::size_t target, std::size_t source);
+  void swapRows(std::size_t lhs, std::size_t rhs);
+  void canonicalize();
+
+  std::size_t                n         = 0U;
+  std::size_t                nrOfWords = 0U;
+  std::vector<std::uint64_t> data;
+  std::vector<std::uint8_t>  phases;
+};
@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include "Profile.hpp"
+#include "SatBackend.hpp"
+
 #include <cstddef>
 #include <map>
 #include <nlohmann/json.hpp>
@@ -17,6 +20,31 @@
 #include <string>
 
 using json = nlohmann::json;
+
+/// input that distinguishes the circuits of a failed equivalence check
+struct Counterexample {
+  bool        found = false;
+  std::size_t input = 0U; // index into the inputs of the check
+  std::string state;      // the input in the notation of the inputs, e.g., xZ
+  std::size_t level = 0U; // first level after which the generators differ
+
+  [[nodiscard]] json to_json() const {
+    if (!found) {
+      return nullptr;
+    }
+    return json{{"input", input}, {"state", state}, {"level", level}};
+  }
+
+  void from_json(const json& j) {
+    found = !j.is_null();
+    if (found) {
+      j.at("input").get_to(input);
+      j.at("state").get_to(state);
+      j.at("level").get_to(level);
+    }
+  }
+};
+
 struct Statistics {
   std::size_t                   nrOfGates            = 0U;
   std::size_t                   nrOfQubits           = 0U;
@@ -25,12 +53,22 @@ struct Statistics {
   std::size_t                   nrOfFunctionalConstr = 0U;
   std::size_t                   circuitDepth         = 0U;
   std::size_t                   nrOfDiffInputStates  = 0U;
-  std::map<std::string, double> z3StatsMap;
+  std::size_t                   nrOfCachedLevels     = 0U; // replayed levels
+  std::string                   satBackend;
+  std::string                   encoding; // encoding of the level variables
+  std::string equivalenceCheck; // miter, direct or unitary
+  std::string levelCompression; // levels that got level variables
+  std::map<std::string, double> solverStatsMap; // statistics of the backend
   bool                          equal               = false;
   bool                          satisfiable         = false;
+  // limit that stopped the check before it reached a verdict, equal and
+  // satisfiable are meaningless unless it is None
+  Interruption                  interruption        = Interruption::None;
   std::size_t                   preprocTime         = 0U;
   std::size_t                   solvingTime         = 0U;
   std::size_t                   satConstructionTime = 0U;
+  Counterexample                counterexample;
+  Profile profile; // nanosecond times of the phases and hot path counters
 
   [[nodiscard]] json to_json() const {
     return json{{"numGates", nrOfGates},
@@ -40,12 +78,20 @@ struct Statistics {
                 {"numFuncConstr", nrOfFunctionalConstr},
                 {"circDepth", circuitDepth},
                 {"numInputs", nrOfDiffInputStates},
-                {"equivalent", equal},
-                {"satisfiable", satisfiable},
+                {"numCachedLevels", nrOfCachedLevels},
+                {"equivalent", decided() ? json(equal) : json(nullptr)},
+                {"satisfiable", decided() ? json(satisfiable) : json(nullptr)},
+                {"interruption", ::toString(interruption)},
                 {"preprocTime", preprocTime},
                 {"solvingTime", solvingTime},
                 {"satConstructionTime", satConstructionTime},
-                {"z3map", z3StatsMap}
+                {"satBackend", satBackend},
+                {"encoding", encoding},
+                {"equivalenceCheck", equivalenceCheck},
+                {"levelCompression", levelCompression},
+                {"solverStats", solverStatsMap},
+                {"counterexample", counterexample.to_json()},
+                {"profile", profile.to_json()}
 
     };
   }
@@ -58,12 +104,39 @@ struct Statistics {
     j.at("numFuncConstr").get_to(nrOfFunctionalConstr);
     j.at("circDepth").get_to(circuitDepth);
     j.at("numInputs").get_to(nrOfDiffInputStates);
-    j.at("equivalent").get_to(equal);
-    j.at("satisfiable").get_to(satisfiable);
+    nrOfCachedLevels = j.value("numCachedLevels", std::size_t{0U});
+    // interrupted checks have neither an equivalence nor a satisfiability
+    const auto& equivalent = j.at("equivalent");
+    const auto& sat        = j.at("satisfiable");
+    equal        = !equivalent.is_null() && equivalent.get<bool>();
+    satisfiable  = !sat.is_null() && sat.get<bool>();
+    interruption = interruptionFromString(j.value("interruption", "none"));
     j.at("preprocTime").get_to(preprocTime);
     j.at("solvingTime").get_to(solvingTime);
     j.at("satConstructionTime").get_to(satConstructionTime);
-    j.at("z3map").get_to(z3StatsMap);
+    // results written before the solver and the encoding became selectable
+    // only used z3 and the binary encoding
+    if (j.contains("solverStats")) {
+      j.at("satBackend").get_to(satBackend);
+      j.at("solverStats").get_to(solverStatsMap);
+    } else {
+      satBackend = "z3";
+      j.at("z3map").get_to(solverStatsMap);
+    }
+    encoding         = j.value("encoding", "binary");
+    equivalenceCheck = j.value("equivalenceCheck", "miter");
+    levelCompression = j.value("levelCompression", "none");
+    if (j.contains("counterexample")) {
+      counterexample.from_json(j.at("counterexample"));
+    }
+    if (j.contains("profile")) {
+      profile.from_json(j.at("profile"));
+    }
+  }
+
+  /// whether the check reached a verdict
+  [[nodiscard]] bool decided() const {
+    return interruption == Interruption::None;
   }
 
   [[nodiscard]] std::string toString() const {
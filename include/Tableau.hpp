@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "CliffordKernels.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// 128-bit fingerprint of a tableau
+struct Fingerprint {
+  std::uint64_t lo = 0U;
+  std::uint64_t hi = 0U;
+
+  Fingerprint& operator^=(const Fingerprint& other) {
+    lo ^= other.lo;
+    hi ^= other.hi;
+    return *this;
+  }
+  bool operator==(const Fingerprint& other) const {
+    return lo == other.lo && hi == other.hi;
+  }
+  bool operator!=(const Fingerprint& other) const { return !(*this == other); }
+};
+
+struct FingerprintHash {
+  std::size_t operator()(const Fingerprint& fingerprint) const {
+    return static_cast<std::size_t>(fingerprint.lo);
+  }
+};
+
+/**
+ * Bit-packed stabilizer tableau (Aaronson-Gottesman representation).
+ *
+ * The tableau is stored column-major in 64-bit words: every column (the x bits
+ * of one qubit, the z bits of one qubit, or the phase bits) holds the bits of
+ * all rows packed into `words()` consecutive words. A tableau either holds the
+ * n stabilizer rows of a state or, see identity(), n destabilizer rows
+ * followed by the n stabilizer rows. Applying a gate to qubit q
+ * thus only touches the columns of q and becomes a word-wide sweep over the
+ * rows through the kernels of `CliffordKernels`. Bits of the last word beyond
+ * `rows()` are always zero.
+ *
+ * The tableau maintains a 128-bit fingerprint incrementally: it is the XOR of
+ * per-column hashes, and a gate only marks the columns it touches as dirty, so
+ * refreshing the fingerprint after a level of gates rehashes only those
+ * columns instead of the whole tableau.
+ */
+class Tableau {
+public:
+  static constexpr std::size_t WORD_BITS = 64U;
+
+  Tableau() = default;
+
+  /**
+   * Creates the tableau of the all-zero state, i.e., row i is stabilized by
+   * Z_i.
+   * @param nrOfQubits number of qubits
+   */
+  explicit Tableau(std::size_t nrOfQubits);
+
+  /**
+   * Creates the 2n-row tableau of the identity: the destabilizer rows X_i
+   * followed by the stabilizer rows Z_i. After applying a circuit, the rows
+   * hold its conjugation action on every X_i and Z_i, which determines the
+   * circuit up to a global phase.
+   * @param nrOfQubits number of qubits
+   */
+  [[nodiscard]] static Tableau identity(std::size_t nrOfQubits);
+
+  /**
+   * Creates a tableau from packed words as returned by raw(), e.g., of a
+   * generator stored in a GeneratorTable.
+   * @param words packed words (x columns, z columns, phases)
+   * @param nrOfQubits number of qubits
+   * @param nrOfRows number of rows, either nrOfQubits or 2 * nrOfQubits
+   */
+  [[nodiscard]] static Tableau fromWords(const std::uint64_t* words,
+                                         std::size_t          nrOfQubits,
+                                         std::size_t          nrOfRows);
+
+  [[nodiscard]] std::size_t qubits() const { return n; }
+  [[nodiscard]] std::size_t rows() const { return nrOfRows; }
+  [[nodiscard]] std::size_t words() const { return nrOfWords; }
+
+  [[nodiscard]] const std::uint64_t* xColumn(const std::size_t qubit) const {
+    return data.data() + (qubit * nrOfWords);
+  }
+  [[nodiscard]] const std::uint64_t* zColumn(const std::size_t qubit) const {
+    return data.data() + ((n + qubit) * nrOfWords);
+  }
+  [[nodiscard]] const std::uint64_t* phases() const {
+    return data.data() + (2U * n * nrOfWords);
+  }
+
+  [[nodiscard]] bool x(std::size_t row, std::size_t qubit) const;
+  [[nodiscard]] bool z(std::size_t row, std::size_t qubit) const;
+  [[nodiscard]] bool r(std::size_t row) const;
+
+  /// use the given kernels instead of the ones picked for the executing CPU
+  void setKernels(const CliffordKernels& k) { kernels = &k; }
+  [[nodiscard]] const CliffordKernels& getKernels() const { return *kernels; }
+
+  /// raw packed words of the whole tableau (x columns, z columns, phases)
+  [[nodiscard]] const std::vector<std::uint64_t>& raw() const { return data; }
+
+  /// fingerprint of the current tableau, equal tableaus have equal ones
+  [[nodiscard]] const Fingerprint& fingerprint() const;
+
+  /**
+   * Unpacks the tableau into the row-major generator matrix [x | z | r] with
+   * one row of length 2n + 1 per stabilizer generator.
+   */
+  [[nodiscard]] std::vector<std::vector<bool>> toGenerator() const;
+
+  void applyCNOT(std::size_t control, std::size_t target);
+  void applyCZ(std::size_t control, std::size_t target);
+  void applyCY(std::size_t control, std::size_t target);
+  void applySwap(std::size_t first, std::size_t second);
+  void applyISwap(std::size_t first, std::size_t second);
+  void applyISwapdg(std::size_t first, std::size_t second);
+  /// CNOT from the first to the second qubit, then from the second to the first
+  void applyDCX(std::size_t first, std::size_t second);
+  /// echoed cross-resonance gate in the convention of Qiskit
+  void applyECR(std::size_t first, std::size_t second);
+  void applyH(std::size_t target);
+  void applyS(std::size_t target);
+  void applySdg(std::size_t target);
+  void applyX(std::size_t target);
+  void applyY(std::size_t target);
+  void applyZ(std::size_t target);
+  /// square root of X, equal to V up to a global phase
+  void applySX(std::size_t target);
+  void applySXdg(std::size_t target);
+  /// applies an arbitrary (e.g., fused) single-qubit Clifford in one sweep
+  void applyClifford(std::size_t target, const SingleQubitClifford& gate);
+
+  bool operator==(const Tableau& other) const {
+    return n == other.n && nrOfRows == other.nrOfRows && data == other.data;
+  }
+  bool operator!=(const Tableau& other) const { return !(*this == other); }
+
+private:
+  Tableau(std::size_t nrOfQubits, bool destabilizers);
+
+  // mutable column access is reserved for the kernels, which keep track of the
+  // columns they change
+  [[nodiscard]] std::uint64_t* xWords(const std::size_t qubit) {
+    return data.data() + (qubit * nrOfWords);
+  }
+  [[nodiscard]] std::uint64_t* zWords(const std::size_t qubit) {
+    return data.data() + ((n + qubit) * nrOfWords);
+  }
+  [[nodiscard]] std::uint64_t* phaseWords() {
+    return data.data() + (2U * n * nrOfWords);
+  }
+  [[nodiscard]] std::size_t columns() const { return (2U * n) + 1U; }
+  // applies a two-qubit kernel that may change all columns of both qubits
+  void applyTwoQubit(CliffordKernels::TwoQubitKernel kernel, std::size_t first,
+                     std::size_t second);
+  void                      markDirty(std::size_t column);
+  /// marks the x and z column of the qubit and the phase column as dirty
+  void markQubitDirty(std::size_t qubit);
+
+  std::size_t                n         = 0U;
+  std::size_t                nrOfRows  = 0U;
+  std::size_t                nrOfWords = 0U;
+  std::vector<std::uint64_t> data;
+  const CliffordKernels*     kernels = &CliffordKernels::active();
+
+  // per-column hashes, their XOR, and the columns changed since the last
+  // refresh of the fingerprint
+  mutable std::vector<Fingerprint> columnHashes;
+  mutable Fingerprint              combined;
+  mutable std::vector<std::size_t> dirtyColumns;
+  mutable std::vector<bool>        dirty;
+};
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * Work-stealing thread pool. Every worker owns a task queue, takes tasks from
+ * the back of its own queue, and steals from the front of the other queues
+ * once its own queue runs dry. Threads waiting for a parallelFor() to finish
+ * help by executing pending tasks, so parallel loops may be nested.
+ */
+class ThreadPool {
+public:
+  /**
+   * @param nrOfThreads number of worker threads, 0 uses one per hardware
+   * thread. With a single thread, all work runs on the calling thread.
+   */
+  explicit ThreadPool(std::size_t nrOfThreads = 0U);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool&)            = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /**
+   * Process-wide pool with one thread per hardware thread, created on first
+   * use. Encoders that do not ask for a number of threads share it, so
+   * concurrent or nested checks neither oversubscribe the CPU nor start and
+   * stop threads for every check.
+   */
+  [[nodiscard]] static std::shared_ptr<ThreadPool> shared();
+
+  /// number of threads that execute work, including the calling thread
+  [[nodiscard]] std::size_t size() const { return workers.size() + 1U; }
+
+  /**
+   * Calls body(i) for all i in [0, count) and returns once all calls have
+   * finished. Indices are handed out in contiguous chunks. If a call throws,
+   * the first exception is rethrown on the calling thread.
+   */
+  void parallelFor(std::size_t                             count,
+                   const std::function<void(std::size_t)>& body);
+
+private:
+  struct Queue {
+    std::mutex                        mutex;
+    std::deque<std::function<void()>> tasks;
+  };
+
+  void submit(std::function<void()> task);
+  bool runPendingTask(std::size_t own);
+  void workerLoop(std::size_t index);
+
+  std::vector<std::unique_ptr<Queue>> queues;
+  std::vector<std::thread>            workers;
+  std::atomic<std::size_t>            pending{0U};
+  std::atomic<std::size_t>            nextQueue{0U};
+  std::mutex                          wakeMutex;
+  std::condition_variable             wake;
+  bool                                stop = false;
+};
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "BinaryStream.hpp"
+
+#include "Hashing.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+using hashing::checksum;
+using hashing::ORDER_MARK;
+
+// file header: magic, version, byte order mark, kind
+constexpr std::uint64_t FILE_MAGIC   = 0x0046425441535551ULL; // "QUSATBF"
+constexpr std::size_t   HEADER_WORDS = 4U;
+constexpr std::size_t   WORD_BYTES   = sizeof(std::uint64_t);
+
+void writeWords(std::ostream& os, const std::uint64_t* words,
+                const std::size_t count) {
+  os.write(reinterpret_cast<const char*>(words),
+           static_cast<std::streamsize>(count * WORD_BYTES));
+}
+
+bool readWords(std::istream& is, std::uint64_t* words,
+               const std::size_t count) {
+  is.read(reinterpret_cast<char*>(words),
+          static_cast<std::streamsize>(count * WORD_BYTES));
+  return static_cast<std::size_t>(is.gcount()) == count * WORD_BYTES;
+}
+} // namespace
+
+BinaryWriter::BinaryWriter(std::ostream& stream, const BinaryKind kind)
+    : os(stream) {
+  const std::array<std::uint64_t, HEADER_WORDS> header{
+      FILE_MAGIC, VERSION, ORDER_MARK, static_cast<std::uint64_t>(kind)};
+  writeWords(os, header.data(), header.size());
+  chunk.reserve(CHUNK_WORDS);
+}
+
+void BinaryWriter::write(const std::uint64_t word) {
+  chunk.push_back(word);
+  if (chunk.size() == CHUNK_WORDS) {
+    flush();
+  }
+}
+
+void BinaryWriter::write(const std::uint64_t* words, const std::size_t count) {
+  for (std::size_t w = 0U; w < count;) {
+    const auto n = std::min(count - w, CHUNK_WORDS - chunk.size());
+    chunk.insert(chunk.end(), words + w, words + w + n);
+    w += n;
+    if (chunk.size() == CHUNK_WORDS) {
+      flush();
+    }
+  }
+}
+
+void BinaryWriter::write(const std::string& text) {
+  write(text.size());
+  for (std::size_t c = 0U; c < text.size(); c += WORD_BYTES) {
+    std::uint64_t word = 0U;
+    std::memcpy(&word, text.data() + c, std::min(WORD_BYTES, text.size() - c));
+    write(word);
+  }
+}
+
+void BinaryWriter::finish() {
+  if (!chunk.empty()) {
+    flush();
+  }
+  flush(); // the empty chunk ends the file
+  os.flush();
+  if (!os) {
+    throw std::runtime_error("Could not write binary file");
+  }
+}
+
+void BinaryWriter::flush() {
+  const std::array<std::uint64_t, 2U> frame{
+      chunk.size(), checksum(chunk.data(), chunk.size())};
+  writeWords(os, frame.data(), frame.size());
+  writeWords(os, chunk.data(), chunk.size());
+  chunk.clear();
+}
+
+BinaryReader::BinaryReader(std::istream& stream, const BinaryKind kind)
+    : is(stream) {
+  std::array<std::uint64_t, HEADER_WORDS> header{};
+  if (!readWords(is, header.data(), header.size()) ||
+      header[0] != FILE_MAGIC) {
+    throw std::runtime_error("Not a binary file of qusat");
+  }
+  if (header[2] != ORDER_MARK) {
+    throw std::runtime_error(
+        "Binary file was written on a machine with another byte order");
+  }
+  if (header[1] != BinaryWriter::VERSION) {
+    throw std::runtime_error("Unsupported version " +
+                             std::to_string(header[1]) + " of binary file");
+  }
+  if (header[3] != static_cast<std::uint64_t>(kind)) {
+    throw std::runtime_error("Binary file holds other contents");
+  }
+}
+
+std::uint64_t BinaryReader::read() {
+  if (pos == chunk.size() && !fill()) {
+    throw std::runtime_error("Binary file ended early");
+  }
+  return chunk[pos++];
+}
+
+void BinaryReader::read(std::uint64_t* words, const std::size_t count) {
+  for (std::size_t w = 0U; w < count;) {
+    if (pos == chunk.size() && !fill()) {
+      throw std::runtime_error("Binary file ended early");
+    }
+    const auto n = std::min(count - w, chunk.size() - pos);
+    std::copy_n(chunk.begin() + static_cast<std::ptrdiff_t>(pos), n,
+                words + w);
+    pos += n;
+    w += n;
+  }
+}
+
+std::string BinaryReader::readString() {
+  const auto  length = read();
+  std::string text;
+  for (std::uint64_t c = 0U; c < length; c += WORD_BYTES) {
+    const auto                   word = read();
+    std::array<char, WORD_BYTES> bytes{};
+    std::memcpy(bytes.data(), &word, WORD_BYTES);
+    text.append(bytes.data(),
+                std::min<std::uint64_t>(WORD_BYTES, length - c));
+  }
+  return text;
+}
+
+bool BinaryReader::atEnd() { return pos == chunk.size() && !fill(); }
+
+bool BinaryReader::fill() {
+  if (ended) {
+    return false;
+  }
+  std::array<std::uint64_t, 2U> frame{};
+  if (!readWords(is, frame.data(), frame.size()) ||
+      frame[0] > BinaryWriter::CHUNK_WORDS) {
+    throw std::runtime_error("Binary file is truncated or corrupted");
+  }
+  chunk.resize(frame[0]);
+  pos = 0U;
+  if (!readWords(is, chunk.data(), chunk.size()) ||
+      checksum(chunk.data(), chunk.size()) != frame[1]) {
+    throw std::runtime_error("Binary file is truncated or corrupted");
+  }
+  ended = chunk.empty();
+  return !ended;
+}
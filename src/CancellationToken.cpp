@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CancellationToken.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+CancellationToken::Subscription::~Subscription() {
+  if (state) {
+    const std::lock_guard lock(state->mutex);
+    state->callbacks.erase(id);
+  }
+}
+
+void CancellationToken::cancel() const {
+  // callbacks run under the lock, so none runs after its unsubscription
+  const std::lock_guard lock(state->mutex);
+  if (state->cancelled.exchange(true)) {
+    return;
+  }
+  for (const auto& [id, callback] : state->callbacks) {
+    callback();
+  }
+}
+
+std::unique_ptr<CancellationToken::Subscription>
+CancellationToken::subscribe(std::function<void()> callback) const {
+  const std::lock_guard lock(state->mutex);
+  if (state->cancelled) {
+    callback();
+    return std::make_unique<Subscription>();
+  }
+  const auto id = state->nextId++;
+  state->callbacks.emplace(id, std::move(callback));
+  return std::make_unique<Subscription>(state, id);
+}
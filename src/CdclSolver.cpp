@@ -0,0 +1,559 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CdclSolver.hpp"
+
+#include "SatBackend.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+constexpr double VARIABLE_DECAY    = 0.95;
+constexpr double CLAUSE_DECAY      = 0.999;
+constexpr double RESCALE_THRESHOLD = 1e100;
+constexpr double RESTART_BASE      = 100.;
+// conflicts between two checks of the limits
+constexpr std::size_t LIMIT_INTERVAL = 64U;
+constexpr std::size_t MEGABYTE       = std::size_t{1} << 20U;
+
+// i-th element of the Luby sequence 1 1 2 1 1 2 4 1 1 2 ...
+double luby(std::size_t i) {
+  std::size_t size = 1U;
+  std::size_t seq  = 0U;
+  while (size < i + 1U) {
+    seq++;
+    size = (2U * size) + 1U;
+  }
+  while (size - 1U != i) {
+    size = (size - 1U) >> 1U;
+    seq--;
+    i = i % size;
+  }
+  return static_cast<double>(std::size_t{1} << seq);
+}
+} // namespace
+
+CdclSolver::Lit CdclSolver::toLit(const Literal literal) {
+  const auto var = static_cast<Lit>(std::abs(literal)) - 1U;
+  return (2U * var) + (literal < 0 ? 1U : 0U);
+}
+
+void CdclSolver::ensureVariable(const std::uint32_t var) {
+  while (assigns.size() <= var) {
+    const auto v = static_cast<std::uint32_t>(assigns.size());
+    assigns.emplace_back(UNDEF_VALUE);
+    levels.emplace_back(0U);
+    reasons.emplace_back(NO_CLAUSE);
+    polarity.emplace_back(false);
+    seen.emplace_back(0U);
+    activity.emplace_back(0.);
+    heapIndex.emplace_back(-1);
+    watches.emplace_back();
+    watches.emplace_back();
+    heapInsert(v);
+  }
+}
+
+void CdclSolver::addClause(const Literal* first, const Literal* last) {
+  if (!ok) {
+    return;
+  }
+  backtrack(0U);
+  std::vector<Lit> lits{};
+  lits.reserve(static_cast<std::size_t>(last - first));
+  for (const auto* it = first; it != last; ++it) {
+    const auto lit = toLit(*it);
+    ensureVariable(lit >> 1U);
+    lits.emplace_back(lit);
+  }
+  // drop duplicates and literals false at the top level, skip tautologies and
+  // clauses that are already satisfied
+  std::sort(lits.begin(), lits.end());
+  std::size_t j = 0U;
+  for (std::size_t i = 0U; i < lits.size(); i++) {
+    const auto value = litValue(lits[i]);
+    if (value == TRUE_VALUE || (i > 0U && lits[i] == (lits[i - 1U] ^ 1U))) {
+      return;
+    }
+    if (value != FALSE_VALUE && (j == 0U || lits[j - 1U] != lits[i])) {
+      lits[j++] = lits[i];
+    }
+  }
+  lits.resize(j);
+
+  if (lits.empty()) {
+    ok = false;
+  } else if (lits.size() == 1U) {
+    enqueue(lits.front(), NO_CLAUSE);
+    ok = propagate() == NO_CLAUSE;
+  } else {
+    attach(std::move(lits), false);
+  }
+}
+
+void CdclSolver::assume(const Literal literal) {
+  const auto lit = toLit(literal);
+  ensureVariable(lit >> 1U);
+  assumptions.emplace_back(lit);
+}
+
+bool CdclSolver::value(const Literal literal) const {
+  const auto var = static_cast<std::size_t>(std::abs(literal)) - 1U;
+  const bool val = var < model.size() && model[var];
+  return literal > 0 ? val : !val;
+}
+
+std::map<std::string, double> CdclSolver::statistics() const {
+  return {{"solves", static_cast<double>(nrOfSolves)},
+          {"variables", static_cast<double>(assigns.size())},
+          {"clauses", static_cast<double>(clauses.size() - nrOfLearnts)},
+          {"learnts", static_cast<double>(nrOfLearnts)},
+          {"conflicts", static_cast<double>(nrOfConflicts)},
+          {"decisions", static_cast<double>(nrOfDecisions)},
+          {"propagations", static_cast<double>(nrOfPropagations)},
+          {"restarts", static_cast<double>(nrOfRestarts)},
+          {"reductions", static_cast<double>(nrOfReductions)}};
+}
+
+std::uint32_t CdclSolver::attach(std::vector<Lit> lits, const bool learnt) {
+  const auto index = static_cast<std::uint32_t>(clauses.size());
+  watches[lits[0] ^ 1U].push_back({index, lits[1]});
+  watches[lits[1] ^ 1U].push_back({index, lits[0]});
+  nrOfStoredLiterals += lits.size();
+  clauses.push_back({std::move(lits), 0., learnt});
+  if (learnt) {
+    nrOfLearnts++;
+    bumpClause(clauses.back());
+  }
+  return index;
+}
+
+void CdclSolver::enqueue(const Lit lit, const std::uint32_t reason) {
+  const auto var = lit >> 1U;
+  assigns[var]   = static_cast<std::uint8_t>((lit & 1U) ^ 1U);
+  levels[var]    = decisionLevel();
+  reasons[var]   = reason;
+  trail.emplace_back(lit);
+}
+
+std::uint32_t CdclSolver::propagate() {
+  while (propagationHead < trail.size()) {
+    const auto p        = trail[propagationHead++];
+    const auto falseLit = p ^ 1U;
+    auto&      ws       = watches[p];
+    nrOfPropagations++;
+
+    std::size_t i = 0U;
+    std::size_t j = 0U;
+    while (i < ws.size()) {
+      const auto w = ws[i++];
+      if (litValue(w.blocker) == TRUE_VALUE) {
+        ws[j++] = w;
+        continue;
+      }
+      auto& lits = clauses[w.clause].lits;
+      if (lits[0] == falseLit) {
+        std::swap(lits[0], lits[1]);
+      }
+      const auto first = lits[0];
+      if (first != w.blocker && litValue(first) == TRUE_VALUE) {
+        ws[j++] = {w.clause, first};
+        continue;
+      }
+      // look for a new literal to watch
+      bool moved = false;
+      for (std::size_t k = 2U; k < lits.size(); k++) {
+        if (litValue(lits[k]) != FALSE_VALUE) {
+          std::swap(lits[1], lits[k]);
+          watches[lits[1] ^ 1U].push_back({w.clause, first});
+          moved = true;
+          break;
+        }
+      }
+      if (moved) {
+        continue;
+      }
+      ws[j++] = {w.clause, first};
+      if (litValue(first) == FALSE_VALUE) {
+        while (i < ws.size()) {
+          ws[j++] = ws[i++];
+        }
+        ws.resize(j);
+        propagationHead = trail.size();
+        return w.clause;
+      }
+      enqueue(first, w.clause);
+    }
+    ws.resize(j);
+  }
+  return NO_CLAUSE;
+}
+
+void CdclSolver::analyze(std::uint32_t conflict, std::vector<Lit>& learnt,
+                         std::uint32_t& backtrackLevel) {
+  learnt.clear();
+  learnt.emplace_back(0U); // room for the asserting literal
+  std::size_t pathCount = 0U;
+  bool        first     = true;
+  Lit         p         = 0U;
+  auto        index     = trail.size();
+
+  do {
+    auto& clause = clauses[conflict];
+    if (clause.learnt) {
+      bumpClause(clause);
+    }
+    // the implied literal of a reason clause is at position 0
+    for (std::size_t k = first ? 0U : 1U; k < clause.lits.size(); k++) {
+      const auto q   = clause.lits[k];
+      const auto var = q >> 1U;
+      if (seen[var] == 0U && levels[var] > 0U) {
+        bumpVariable(var);
+        seen[var] = 1U;
+        if (levels[var] >= decisionLevel()) {
+          pathCount++;
+        } else {
+          learnt.emplace_back(q);
+        }
+      }
+    }
+    first = false;
+    while (seen[trail[--index] >> 1U] == 0U) {
+    }
+    p             = trail[index];
+    conflict      = reasons[p >> 1U];
+    seen[p >> 1U] = 0U;
+    pathCount--;
+  } while (pathCount > 0U);
+  learnt[0] = p ^ 1U;
+
+  // drop literals that are implied by the other literals of the clause
+  const auto  all = learnt;
+  std::size_t j   = 1U;
+  for (std::size_t i = 1U; i < learnt.size(); i++) {
+    const auto reason = reasons[learnt[i] >> 1U];
+    bool       keep   = reason == NO_CLAUSE;
+    if (!keep) {
+      for (std::size_t k = 1U; k < clauses[reason].lits.size(); k++) {
+        const auto var = clauses[reason].lits[k] >> 1U;
+        if (seen[var] == 0U && levels[var] > 0U) {
+          keep = true;
+          break;
+        }
+      }
+    }
+    if (keep) {
+      learnt[j++] = learnt[i];
+    }
+  }
+  learnt.resize(j);
+  for (const auto lit : all) {
+    seen[lit >> 1U] = 0U;
+  }
+
+  // the literal with the highest level below the current one is watched next
+  backtrackLevel = 0U;
+  if (learnt.size() > 1U) {
+    std::size_t max = 1U;
+    for (std::size_t i = 2U; i < learnt.size(); i++) {
+      if (levels[learnt[i] >> 1U] > levels[learnt[max] >> 1U]) {
+        max = i;
+      }
+    }
+    std::swap(learnt[1], learnt[max]);
+    backtrackLevel = levels[learnt[1] >> 1U];
+  }
+}
+
+void CdclSolver::backtrack(const std::uint32_t level) {
+  if (decisionLevel() <= level) {
+    return;
+  }
+  for (auto i = trail.size(); i > trailLimits[level]; i--) {
+    const auto var = trail[i - 1U] >> 1U;
+    polarity[var]  = assigns[var] == TRUE_VALUE;
+    assigns[var]   = UNDEF_VALUE;
+    reasons[var]   = NO_CLAUSE;
+    heapInsert(var);
+  }
+  trail.resize(trailLimits[level]);
+  trailLimits.resize(level);
+  propagationHead = trail.size();
+}
+
+void CdclSolver::reduceLearnts() {
+  nrOfReductions++;
+  std::vector<std::uint32_t> candidates{};
+  for (std::uint32_t i = 0U; i < clauses.size(); i++) {
+    const auto& clause = clauses[i];
+    if (!clause.learnt || clause.lits.size() <= 2U) {
+      continue;
+    }
+    // clauses that are the reason of an assignment have to stay
+    const auto var = clause.lits[0] >> 1U;
+    if (reasons[var] == i && litValue(clause.lits[0]) == TRUE_VALUE) {
+      continue;
+    }
+    candidates.emplace_back(i);
+  }
+  std::sort(candidates.begin(), candidates.end(),
+            [this](const std::uint32_t a, const std::uint32_t b) {
+              return clauses[a].activity < clauses[b].activity;
+            });
+  candidates.resize(candidates.size() / 2U);
+  std::vector<bool> deleted(clauses.size(), false);
+  for (const auto i : candidates) {
+    nrOfStoredLiterals -= clauses[i].lits.size();
+    deleted[i] = true;
+    nrOfLearnts--;
+  }
+
+  // the remaining clauses are compacted, so the database and its memory do
+  // not grow with the number of conflicts, and every index is remapped
+  std::vector<std::uint32_t> remap(clauses.size(), NO_CLAUSE);
+  std::uint32_t              next = 0U;
+  for (std::uint32_t i = 0U; i < clauses.size(); i++) {
+    if (deleted[i]) {
+      continue;
+    }
+    remap[i] = next;
+    if (next != i) {
+      clauses[next] = std::move(clauses[i]);
+    }
+    next++;
+  }
+  clauses.resize(next);
+  clauses.shrink_to_fit();
+  for (auto& ws : watches) {
+    std::size_t j = 0U;
+    for (const auto& w : ws) {
+      if (remap[w.clause] != NO_CLAUSE) {
+        ws[j++] = {remap[w.clause], w.blocker};
+      }
+    }
+    ws.resize(j);
+  }
+  for (auto& reason : reasons) {
+    if (reason != NO_CLAUSE) {
+      reason = remap[reason];
+    }
+  }
+}
+
+std::size_t CdclSolver::memoryUsage() const {
+  const auto vars = assigns.size();
+  return (nrOfStoredLiterals * sizeof(Lit)) +
+         (clauses.size() * (sizeof(Clause) + (2U * sizeof(Watcher)))) +
+         (vars * (2U * sizeof(std::vector<Watcher>) + sizeof(double) +
+                  sizeof(std::int64_t) + (4U * sizeof(std::uint32_t)) + 2U));
+}
+
+bool CdclSolver::reachedLimit() {
+  stopped = pollLimits();
+  if (stopped == Interruption::None && limits.resourceLimit > 0U &&
+      nrOfPropagations - propagationsBeforeSolve >= limits.resourceLimit) {
+    stopped = Interruption::ResourceLimit;
+  }
+  if (stopped == Interruption::None && limits.memoryLimit > 0U &&
+      memoryUsage() >= limits.memoryLimit * MEGABYTE) {
+    stopped = Interruption::MemoryLimit;
+  }
+  return stopped != Interruption::None;
+}
+
+SatResult CdclSolver::search() {
+  std::size_t      conflictsSinceRestart = 0U;
+  double           restartLimit          = RESTART_BASE * luby(nrOfRestarts);
+  std::vector<Lit> learnt{};
+
+  while (true) {
+    const auto conflict = propagate();
+    if (conflict != NO_CLAUSE) {
+      nrOfConflicts++;
+      conflictsSinceRestart++;
+      if (decisionLevel() == 0U) {
+        ok = false;
+        return SatResult::Unsatisfiable;
+      }
+      if (nrOfConflicts % LIMIT_INTERVAL == 0U && reachedLimit()) {
+        return SatResult::Unknown;
+      }
+      std::uint32_t backtrackLevel = 0U;
+      analyze(conflict, learnt, backtrackLevel);
+      backtrack(backtrackLevel);
+      if (learnt.size() == 1U) {
+        enqueue(learnt.front(), NO_CLAUSE);
+      } else {
+        enqueue(learnt.front(), attach(learnt, true));
+      }
+      variableIncrement /= VARIABLE_DECAY;
+      clauseIncrement /= CLAUSE_DECAY;
+      continue;
+    }
+
+    if (static_cast<double>(conflictsSinceRestart) >= restartLimit) {
+      nrOfRestarts++;
+      backtrack(0U);
+      conflictsSinceRestart = 0U;
+      restartLimit          = RESTART_BASE * luby(nrOfRestarts);
+      continue;
+    }
+    if (static_cast<double>(nrOfLearnts) >=
+        maxLearnts + static_cast<double>(trail.size())) {
+      reduceLearnts();
+      maxLearnts *= 1.1;
+    }
+
+    // assumptions are decided first, one per decision level
+    Lit  next    = 0U;
+    bool decided = false;
+    while (decisionLevel() < assumptions.size()) {
+      const auto p = assumptions[decisionLevel()];
+      if (litValue(p) == TRUE_VALUE) {
+        trailLimits.emplace_back(trail.size()); // dummy level
+      } else if (litValue(p) == FALSE_VALUE) {
+        return SatResult::Unsatisfiable;
+      } else {
+        next    = p;
+        decided = true;
+        break;
+      }
+    }
+    if (!decided) {
+      std::uint32_t var = NO_CLAUSE;
+      while (!heap.empty()) {
+        const auto candidate = heapPop();
+        if (assigns[candidate] == UNDEF_VALUE) {
+          var = candidate;
+          break;
+        }
+      }
+      if (var == NO_CLAUSE) {
+        return SatResult::Satisfiable;
+      }
+      next = (2U * var) + (polarity[var] ? 0U : 1U);
+    }
+    nrOfDecisions++;
+    trailLimits.emplace_back(trail.size());
+    enqueue(next, NO_CLAUSE);
+  }
+}
+
+SatResult CdclSolver::solve() {
+  nrOfSolves++;
+  model.clear();
+  stopped                 = Interruption::None;
+  propagationsBeforeSolve = nrOfPropagations;
+  auto result             = SatResult::Unsatisfiable;
+  if (ok && reachedLimit()) {
+    result = SatResult::Unknown;
+  } else if (ok) {
+    maxLearnts = std::max(
+        1000., static_cast<double>(clauses.size() - nrOfLearnts) / 3.);
+    result = search();
+  }
+  if (result == SatResult::Satisfiable) {
+    model.resize(assigns.size());
+    for (std::size_t v = 0U; v < assigns.size(); v++) {
+      model[v] = assigns[v] == TRUE_VALUE;
+    }
+  }
+  backtrack(0U);
+  assumptions.clear();
+  return result;
+}
+
+void CdclSolver::bumpVariable(const std::uint32_t var) {
+  activity[var] += variableIncrement;
+  if (activity[var] > RESCALE_THRESHOLD) {
+    for (auto& a : activity) {
+      a /= RESCALE_THRESHOLD;
+    }
+    variableIncrement /= RESCALE_THRESHOLD;
+  }
+  if (heapIndex[var] >= 0) {
+    heapUp(static_cast<std::size_t>(heapIndex[var]));
+  }
+}
+
+void CdclSolver::bumpClause(Clause& clause) {
+  clause.activity += clauseIncrement;
+  if (clause.activity > RESCALE_THRESHOLD) {
+    for (auto& c : clauses) {
+      c.activity /= RESCALE_THRESHOLD;
+    }
+    clauseIncrement /= RESCALE_THRESHOLD;
+  }
+}
+
+void CdclSolver::heapInsert(const std::uint32_t var) {
+  if (heapIndex[var] >= 0) {
+    return;
+  }
+  heapIndex[var] = static_cast<std::int64_t>(heap.size());
+  heap.emplace_back(var);
+  heapUp(heap.size() - 1U);
+}
+
+void CdclSolver::heapUp(std::size_t pos) {
+  const auto var = heap[pos];
+  while (pos > 0U) {
+    const auto parent = (pos - 1U) / 2U;
+    if (activity[heap[parent]] >= activity[var]) {
+      break;
+    }
+    heap[pos]            = heap[parent];
+    heapIndex[heap[pos]] = static_cast<std::int64_t>(pos);
+    pos                  = parent;
+  }
+  heap[pos]      = var;
+  heapIndex[var] = static_cast<std::int64_t>(pos);
+}
+
+void CdclSolver::heapDown(std::size_t pos) {
+  const auto var = heap[pos];
+  while (true) {
+    auto child = (2U * pos) + 1U;
+    if (child >= heap.size()) {
+      break;
+    }
+    if (child + 1U < heap.size() &&
+        activity[heap[child + 1U]] > activity[heap[child]]) {
+      child++;
+    }
+    if (activity[heap[child]] <= activity[var]) {
+      break;
+    }
+    heap[pos]            = heap[child];
+    heapIndex[heap[pos]] = static_cast<std::int64_t>(pos);
+    pos                  = child;
+  }
+  heap[pos]      = var;
+  heapIndex[var] = static_cast<std::int64_t>(pos);
+}
+
+std::uint32_t CdclSolver::heapPop() {
+  const auto top = heap.front();
+  heapIndex[top] = -1;
+  heap.front()   = heap.back();
+  heap.pop_back();
+  if (!heap.empty()) {
+    heapIndex[heap.front()] = 0;
+    heapDown(0U);
+  }
+  return top;
+}
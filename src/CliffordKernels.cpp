@@ -0,0 +1,381 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CliffordKernels.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) &&                              \
+    (defined(__GNUC__) || defined(__clang__))
+#define QUSAT_X86_KERNELS
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define QUSAT_X86_KERNELS
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+namespace {
+/*
+ * Single-qubit Clifford group
+ */
+using Action = SingleQubitClifford::Action;
+
+constexpr Action IDENTITY_ACTION{true, false, false, true, false, false, false};
+constexpr Action H_ACTION{false, true, true, false, false, false, true};
+constexpr Action S_ACTION{true, false, true, true, false, false, true};
+
+// image (x', z', phase flip) of a single row under the given action
+std::array<bool, 3> applyAction(const Action& a, const bool x, const bool z) {
+  const bool xs   = (x && a.xFromX) != (z && a.xFromZ);
+  const bool zs   = (x && a.zFromX) != (z && a.zFromZ);
+  bool       flip = false;
+  if (x && z) {
+    flip = a.phaseY;
+  } else if (x) {
+    flip = a.phaseX;
+  } else if (z) {
+    flip = a.phaseZ;
+  }
+  return {xs, zs, flip};
+}
+
+// action of first applying `first` and then `second`
+Action compose(const Action& first, const Action& second) {
+  Action result{};
+  const auto image = [&](const bool x, const bool z) {
+    const auto [x1, z1, p1] = applyAction(first, x, z);
+    const auto [x2, z2, p2] = applyAction(second, x1, z1);
+    return std::array<bool, 3>{x2, z2, p1 != p2};
+  };
+  const auto fromX = image(true, false);
+  const auto fromZ = image(false, true);
+  const auto fromY = image(true, true);
+  result.xFromX    = fromX[0];
+  result.zFromX    = fromX[1];
+  result.phaseX    = fromX[2];
+  result.xFromZ    = fromZ[0];
+  result.zFromZ    = fromZ[1];
+  result.phaseZ    = fromZ[2];
+  result.phaseY    = fromY[2];
+  return result;
+}
+
+bool operator==(const Action& lhs, const Action& rhs) {
+  return lhs.xFromX == rhs.xFromX && lhs.xFromZ == rhs.xFromZ &&
+         lhs.zFromX == rhs.zFromX && lhs.zFromZ == rhs.zFromZ &&
+         lhs.phaseX == rhs.phaseX && lhs.phaseZ == rhs.phaseZ &&
+         lhs.phaseY == rhs.phaseY;
+}
+
+struct CliffordGroup {
+  std::array<Action, SingleQubitClifford::GROUP_ORDER> actions{};
+  std::array<std::array<std::uint8_t, SingleQubitClifford::GROUP_ORDER>,
+             SingleQubitClifford::GROUP_ORDER>
+               products{};
+  std::uint8_t h = 0U;
+  std::uint8_t s = 0U;
+
+  CliffordGroup() {
+    // enumerate the group breadth-first from the identity using H and S
+    std::size_t size = 0U;
+    actions[size++]  = IDENTITY_ACTION;
+    for (std::size_t i = 0U; i < size; ++i) {
+      for (const auto& generator : {H_ACTION, S_ACTION}) {
+        const auto next = compose(actions[i], generator);
+        if (find(next, size) == size) {
+          if (size == SingleQubitClifford::GROUP_ORDER) {
+            throw std::logic_error("Single-qubit Clifford group too large");
+          }
+          actions[size++] = next;
+        }
+      }
+    }
+    if (size != SingleQubitClifford::GROUP_ORDER) {
+      throw std::logic_error("Single-qubit Clifford group incomplete");
+    }
+    for (std::size_t i = 0U; i < size; ++i) {
+      for (std::size_t j = 0U; j < size; ++j) {
+        products[i][j] = static_cast<std::uint8_t>(
+            find(compose(actions[i], actions[j]), size));
+      }
+    }
+    h = static_cast<std::uint8_t>(find(H_ACTION, size));
+    s = static_cast<std::uint8_t>(find(S_ACTION, size));
+  }
+
+  [[nodiscard]] std::size_t find(const Action& action,
+                                 const std::size_t size) const {
+    for (std::size_t i = 0U; i < size; ++i) {
+      if (actions[i] == action) {
+        return i;
+      }
+    }
+    return size;
+  }
+};
+
+const CliffordGroup& cliffordGroup() {
+  static const CliffordGroup group{};
+  return group;
+}
+
+/*
+ * Kernels
+ */
+struct ScalarLane {
+  using Word                        = std::uint64_t;
+  static constexpr std::size_t WORDS = 1U;
+
+  static Word load(const std::uint64_t* p) { return *p; }
+  static void store(std::uint64_t* p, const Word v) { *p = v; }
+  static Word bitXor(const Word a, const Word b) { return a ^ b; }
+  static Word bitAnd(const Word a, const Word b) { return a & b; }
+  // ~a & b
+  static Word andNot(const Word a, const Word b) { return ~a & b; }
+  static Word broadcast(const bool bit) { return bit ? ~Word{0} : Word{0}; }
+};
+
+namespace scalar {
+using Lane = ScalarLane;
+#include "CliffordKernels.inc"
+} // namespace scalar
+
+#ifdef QUSAT_X86_KERNELS
+// vector kernels are compiled for their instruction set only, the executing
+// CPU is checked before any of them is selected
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2"))),                  \
+                             apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx2")
+#endif
+namespace avx2 {
+struct Lane {
+  using Word                        = __m256i;
+  static constexpr std::size_t WORDS = 4U;
+
+  static Word load(const std::uint64_t* p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  }
+  static void store(std::uint64_t* p, const Word v) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+  }
+  static Word bitXor(const Word a, const Word b) {
+    return _mm256_xor_si256(a, b);
+  }
+  static Word bitAnd(const Word a, const Word b) {
+    return _mm256_and_si256(a, b);
+  }
+  static Word andNot(const Word a, const Word b) {
+    return _mm256_andnot_si256(a, b);
+  }
+  static Word broadcast(const bool bit) {
+    return _mm256_set1_epi64x(bit ? -1 : 0);
+  }
+};
+#include "CliffordKernels.inc"
+} // namespace avx2
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f"))),               \
+                             apply_to = function)
+#elif defined(__GNUC__)
+#pragma GCC push_options
+#pragma GCC target("avx512f")
+#endif
+namespace avx512 {
+struct Lane {
+  using Word                        = __m512i;
+  static constexpr std::size_t WORDS = 8U;
+
+  static Word load(const std::uint64_t* p) { return _mm512_loadu_si512(p); }
+  static void store(std::uint64_t* p, const Word v) {
+    _mm512_storeu_si512(p, v);
+  }
+  static Word bitXor(const Word a, const Word b) {
+    return _mm512_xor_si512(a, b);
+  }
+  static Word bitAnd(const Word a, const Word b) {
+    return _mm512_and_si512(a, b);
+  }
+  static Word andNot(const Word a, const Word b) {
+    return _mm512_and_si512(_mm512_xor_si512(a, _mm512_set1_epi64(-1)), b);
+  }
+  static Word broadcast(const bool bit) {
+    return _mm512_set1_epi64(bit ? -1 : 0);
+  }
+};
+#include "CliffordKernels.inc"
+} // namespace avx512
+#if defined(__clang__)
+#pragma clang attribute pop
+#elif defined(__GNUC__)
+#pragma GCC pop_options
+#endif
+
+#ifdef _MSC_VER
+bool cpuSupports(const CliffordKernels::Isa isa) {
+  int info[4]{};
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info, 1);
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  if (!osxsave) {
+    return false;
+  }
+  const auto xcr0 = _xgetbv(0);
+  __cpuidex(info, 7, 0);
+  if (isa == CliffordKernels::Isa::AVX2) {
+    return (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6U) == 0x6U;
+  }
+  return (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6U) == 0xE6U;
+}
+#else
+bool cpuSupports(const CliffordKernels::Isa isa) {
+  __builtin_cpu_init();
+  if (isa == CliffordKernels::Isa::AVX2) {
+    return __builtin_cpu_supports("avx2") != 0;
+  }
+  return __builtin_cpu_supports("avx512f") != 0;
+}
+#endif
+#endif
+
+const CliffordKernels SCALAR{
+    CliffordKernels::Isa::Scalar, "scalar",         scalar::h,
+    scalar::s,                    scalar::sdg,      scalar::pauliX,
+    scalar::pauliY,               scalar::pauliZ,   scalar::sx,
+    scalar::sxdg,                 scalar::clifford, scalar::cnot,
+    scalar::cz,                   scalar::cy,       scalar::swap,
+    scalar::iswap,                scalar::iswapdg,  scalar::dcx,
+    scalar::ecr};
+#ifdef QUSAT_X86_KERNELS
+const CliffordKernels AVX2{
+    CliffordKernels::Isa::AVX2, "avx2",         avx2::h,
+    avx2::s,                    avx2::sdg,      avx2::pauliX,
+    avx2::pauliY,               avx2::pauliZ,   avx2::sx,
+    avx2::sxdg,                 avx2::clifford, avx2::cnot,
+    avx2::cz,                   avx2::cy,       avx2::swap,
+    avx2::iswap,                avx2::iswapdg,  avx2::dcx,
+    avx2::ecr};
+const CliffordKernels AVX512{
+    CliffordKernels::Isa::AVX512, "avx512",         avx512::h,
+    avx512::s,                    avx512::sdg,      avx512::pauliX,
+    avx512::pauliY,               avx512::pauliZ,   avx512::sx,
+    avx512::sxdg,                 avx512::clifford, avx512::cnot,
+    avx512::cz,                   avx512::cy,       avx512::swap,
+    avx512::iswap,                avx512::iswapdg,  avx512::dcx,
+    avx512::ecr};
+#endif
+
+bool isAvailable(const CliffordKernels::Isa isa) {
+  if (isa == CliffordKernels::Isa::Scalar) {
+    return true;
+  }
+#ifdef QUSAT_X86_KERNELS
+  return cpuSupports(isa);
+#else
+  return false;
+#endif
+}
+} // namespace
+
+SingleQubitClifford SingleQubitClifford::fromIndex(const std::uint8_t index) {
+  if (index >= GROUP_ORDER) {
+    throw std::out_of_range("Invalid single-qubit Clifford index");
+  }
+  return SingleQubitClifford(index);
+}
+
+SingleQubitClifford SingleQubitClifford::h() {
+  return SingleQubitClifford(cliffordGroup().h);
+}
+
+SingleQubitClifford SingleQubitClifford::s() {
+  return SingleQubitClifford(cliffordGroup().s);
+}
+
+SingleQubitClifford SingleQubitClifford::sdg() {
+  return s().then(s()).then(s());
+}
+
+SingleQubitClifford SingleQubitClifford::x() { return h().then(z()).then(h()); }
+
+SingleQubitClifford SingleQubitClifford::y() { return z().then(x()); }
+
+SingleQubitClifford SingleQubitClifford::z() { return s().then(s()); }
+
+SingleQubitClifford SingleQubitClifford::sx() {
+  return h().then(s()).then(h());
+}
+
+SingleQubitClifford SingleQubitClifford::sxdg() {
+  return h().then(sdg()).then(h());
+}
+
+SingleQubitClifford
+SingleQubitClifford::then(const SingleQubitClifford& next) const {
+  return SingleQubitClifford(cliffordGroup().products[idx][next.idx]);
+}
+
+const SingleQubitClifford::Action& SingleQubitClifford::action() const {
+  return cliffordGroup().actions[idx];
+}
+
+const CliffordKernels& CliffordKernels::get(const Isa isa) {
+  if (!isAvailable(isa)) {
+    return SCALAR;
+  }
+#ifdef QUSAT_X86_KERNELS
+  if (isa == Isa::AVX512) {
+    return AVX512;
+  }
+  if (isa == Isa::AVX2) {
+    return AVX2;
+  }
+#endif
+  return SCALAR;
+}
+
+const CliffordKernels& CliffordKernels::active() {
+  static const CliffordKernels& kernels = []() -> const CliffordKernels& {
+    if (isAvailable(Isa::AVX512)) {
+      return get(Isa::AVX512);
+    }
+    if (isAvailable(Isa::AVX2)) {
+      return get(Isa::AVX2);
+    }
+    return SCALAR;
+  }();
+  return kernels;
+}
+
+std::vector<CliffordKernels::Isa> CliffordKernels::available() {
+  std::vector<Isa> result{Isa::Scalar};
+  for (const auto isa : {Isa::AVX2, Isa::AVX512}) {
+    if (isAvailable(isa)) {
+      result.emplace_back(isa);
+    }
+  }
+  return result;
+}
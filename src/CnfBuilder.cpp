@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CnfBuilder.hpp"
+
+#include "BinaryStream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+std::vector<CnfBuilder::Literal>
+CnfBuilder::newVariables(const std::size_t count) {
+  std::vector<Literal> result(count);
+  for (auto& variable : result) {
+    variable = newVariable();
+  }
+  return result;
+}
+
+void CnfBuilder::addClause(const std::initializer_list<Literal> clause) {
+  const auto begin = buffer.size();
+  buffer.insert(buffer.end(), clause.begin(), clause.end());
+  endClause(begin);
+}
+
+void CnfBuilder::addClause(const std::vector<Literal>& clause) {
+  const auto begin = buffer.size();
+  buffer.insert(buffer.end(), clause.begin(), clause.end());
+  endClause(begin);
+}
+
+void CnfBuilder::endClause(const std::size_t begin) {
+  nrOfClauses++;
+  if (sink == nullptr) {
+    buffer.emplace_back(0);
+    return;
+  }
+  sink->addClause(buffer.data() + begin, buffer.data() + buffer.size());
+  buffer.resize(begin);
+}
+
+std::vector<CnfBuilder::Literal>
+CnfBuilder::equals(const std::vector<Literal>& bits,
+                   const std::uint64_t         value) {
+  std::vector<Literal> result(bits.size());
+  for (std::size_t i = 0U; i < bits.size(); i++) {
+    result[i] = ((value >> i) & 1U) != 0U ? bits[i] : -bits[i];
+  }
+  return result;
+}
+
+void CnfBuilder::addImplication(const std::vector<Literal>& premise,
+                                const std::vector<Literal>& conclusion) {
+  // one clause (\/ -premise) \/ c per literal c of the conclusion
+  for (const auto c : conclusion) {
+    const auto begin = buffer.size();
+    for (const auto p : premise) {
+      buffer.emplace_back(-p);
+    }
+    buffer.emplace_back(c);
+    endClause(begin);
+  }
+}
+
+void CnfBuilder::addLessThan(const std::vector<Literal>& bits,
+                             const std::uint64_t         bound) {
+  if (bits.size() < 64U && bound >= (std::uint64_t{1} << bits.size())) {
+    return; // holds for every assignment
+  }
+  if (bound == 0U) {
+    addClause({}); // holds for no assignment
+    return;
+  }
+  // bits <= max: for every 0 bit of max, the number must not have a 1 there
+  // while matching all 1 bits of max above it
+  const auto max = bound - 1U;
+  for (std::size_t i = 0U; i < bits.size(); i++) {
+    if (((max >> i) & 1U) != 0U) {
+      continue;
+    }
+    const auto begin = buffer.size();
+    buffer.emplace_back(-bits[i]);
+    for (std::size_t j = i + 1U; j < bits.size(); j++) {
+      if (((max >> j) & 1U) != 0U) {
+        buffer.emplace_back(-bits[j]);
+      }
+    }
+    endClause(begin);
+  }
+}
+
+void CnfBuilder::addAtMostOne(const std::vector<Literal>& lits) {
+  if (lits.size() <= 4U) {
+    // pairwise
+    for (std::size_t i = 0U; i < lits.size(); i++) {
+      for (std::size_t j = i + 1U; j < lits.size(); j++) {
+        addClause({-lits[i], -lits[j]});
+      }
+    }
+    return;
+  }
+  // sequential counter: s_i holds if one of the first i + 1 literals is true
+  const auto n = lits.size();
+  const auto s = newVariables(n - 1U);
+  addClause({-lits[0], s[0]});
+  for (std::size_t i = 1U; i + 1U < n; i++) {
+    addClause({-lits[i], s[i]});
+    addClause({-s[i - 1U], s[i]});
+    addClause({-lits[i], -s[i - 1U]});
+  }
+  addClause({-lits[n - 1U], -s[n - 2U]});
+}
+
+void CnfBuilder::addEqual(const std::vector<Literal>& lhs,
+                          const std::vector<Literal>& rhs) {
+  for (std::size_t i = 0U; i < lhs.size(); i++) {
+    addClause({-lhs[i], rhs[i]});
+    addClause({lhs[i], -rhs[i]});
+  }
+}
+
+void CnfBuilder::addNotEqual(const std::vector<Literal>& lhs,
+                             const std::vector<Literal>& rhs) {
+  // d_i -> (lhs_i xor rhs_i), and at least one d_i holds
+  std::vector<Literal> differs(lhs.size());
+  for (std::size_t i = 0U; i < lhs.size(); i++) {
+    differs[i] = newVariable();
+    addClause({-differs[i], lhs[i], rhs[i]});
+    addClause({-differs[i], -lhs[i], -rhs[i]});
+  }
+  addClause(differs);
+}
+
+void CnfBuilder::writeDIMACS(std::ostream& os) const {
+  os << "p cnf " << nrOfVariables << " " << nrOfClauses << "\n";
+  forEachClause([&os](const Literal* first, const Literal* last) {
+    for (const auto* it = first; it != last; ++it) {
+      os << *it << " ";
+    }
+    os << "0\n";
+  });
+}
+
+std::string CnfBuilder::toDIMACS() const {
+  std::ostringstream ss{};
+  writeDIMACS(ss);
+  return ss.str();
+}
+
+void CnfBuilder::writeBinary(std::ostream& os) const {
+  BinaryWriter writer(os, BinaryKind::Cnf);
+  writer.write(variables());
+  writer.write(nrOfClauses);
+  writer.write(buffer.size());
+  for (std::size_t i = 0U; i < buffer.size(); i += 2U) {
+    const std::uint64_t low  = static_cast<std::uint32_t>(buffer[i]);
+    const std::uint64_t high = i + 1U < buffer.size()
+                                   ? static_cast<std::uint32_t>(buffer[i + 1U])
+                                   : 0U;
+    writer.write(low | (high << 32U));
+  }
+  writer.finish();
+}
+
+CnfBuilder CnfBuilder::readBinary(std::istream& is) {
+  BinaryReader reader(is, BinaryKind::Cnf);
+  CnfBuilder   cnf{};
+  const auto   variables = reader.read();
+  const auto   clauses   = reader.read();
+  const auto   literals  = reader.read();
+  if (variables >
+      static_cast<std::uint64_t>(std::numeric_limits<Literal>::max())) {
+    throw std::runtime_error("Binary CNF has too many variables");
+  }
+  cnf.nrOfVariables = static_cast<Literal>(variables);
+  for (std::uint64_t i = 0U; i < literals; i += 2U) {
+    const auto word = reader.read();
+    cnf.buffer.push_back(static_cast<Literal>(
+        static_cast<std::uint32_t>(word & 0xffffffffU)));
+    if (i + 1U < literals) {
+      cnf.buffer.push_back(
+          static_cast<Literal>(static_cast<std::uint32_t>(word >> 32U)));
+    }
+  }
+  // every literal has to be a variable of the instance, every clause ends
+  for (const auto lit : cnf.buffer) {
+    if (static_cast<std::uint64_t>(std::abs(static_cast<std::int64_t>(lit))) >
+        variables) {
+      throw std::runtime_error("Binary CNF has a literal of no variable");
+    }
+    cnf.nrOfClauses += lit == 0 ? 1U : 0U;
+  }
+  if (cnf.nrOfClauses != clauses ||
+      (!cnf.buffer.empty() && cnf.buffer.back() != 0) || !reader.atEnd()) {
+    throw std::runtime_error("Binary CNF is inconsistent");
+  }
+  return cnf;
+}
+
+void CnfBuilder::clear() {
+  nrOfVariables = 0;
+  nrOfClauses   = 0U;
+  buffer.clear();
+}
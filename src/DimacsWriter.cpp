@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "DimacsWriter.hpp"
+
+#include "CnfBuilder.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if QUSAT_HAS_ZLIB
+#include <zlib.h>
+#endif
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <sys/stat.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+int openFile(const std::string& path) {
+#ifdef _WIN32
+  return ::_open(path.c_str(), _O_WRONLY | _O_CREAT | _O_TRUNC | _O_BINARY,
+                 _S_IREAD | _S_IWRITE);
+#else
+  return ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+#endif
+}
+
+void closeFile(const int fd) {
+#ifdef _WIN32
+  ::_close(fd);
+#else
+  ::close(fd);
+#endif
+}
+
+// writes all bytes, returns false on an error
+bool writeAll(const int fd, const char* data, std::size_t size) {
+  while (size > 0U) {
+#ifdef _WIN32
+    const auto result = ::_write(fd, data, static_cast<unsigned>(size));
+#else
+    const auto result = ::write(fd, data, size);
+#endif
+    if (result <= 0) {
+      return false;
+    }
+    data += result;
+    size -= static_cast<std::size_t>(result);
+  }
+  return true;
+}
+
+void requireGzip(const bool gzip) {
+  if (gzip && !DimacsWriter::gzipSupported()) {
+    throw std::runtime_error("qusat was built without gzip support");
+  }
+}
+} // namespace
+
+DimacsWriter::DimacsWriter(const std::string& path, const bool gzip) {
+  requireGzip(gzip);
+  fd = openFile(path);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open DIMACS file " + path);
+  }
+  ownsFd = true;
+  buffer.reserve(BUFFER_BYTES);
+#if QUSAT_HAS_ZLIB
+  if (gzip) {
+    // the compressed stream closes the descriptor it is given
+    gz     = gzdopen(fd, "wb");
+    ownsFd = false;
+    failed = gz == nullptr;
+  }
+#endif
+}
+
+DimacsWriter::DimacsWriter(const int descriptor, const bool gzip)
+    : fd(descriptor) {
+  requireGzip(gzip);
+  buffer.reserve(BUFFER_BYTES);
+#if QUSAT_HAS_ZLIB
+  if (gzip) {
+    // a duplicate is handed to the compressed stream, which closes it
+#ifdef _WIN32
+    const auto duplicate = ::_dup(fd);
+#else
+    const auto duplicate = ::dup(fd);
+#endif
+    gz     = duplicate < 0 ? nullptr : gzdopen(duplicate, "wb");
+    failed = gz == nullptr;
+  }
+#endif
+}
+
+DimacsWriter::~DimacsWriter() {
+  try {
+    finish();
+  } catch (...) { // NOLINT(bugprone-empty-catch)
+    // errors are only reported by an explicit finish()
+  }
+}
+
+bool DimacsWriter::gzipSupported() {
+#if QUSAT_HAS_ZLIB
+  return true;
+#else
+  return false;
+#endif
+}
+
+void DimacsWriter::comment(const std::string& text) {
+  if (started) {
+    throw std::logic_error("DIMACS comments have to precede the problem line");
+  }
+  std::size_t begin = 0U;
+  while (begin <= text.size()) {
+    auto end = text.find('\n', begin);
+    if (end == std::string::npos) {
+      end = text.size();
+    }
+    put("c ", 2U);
+    put(text.data() + begin, end - begin);
+    put("\n", 1U);
+    begin = end + 1U;
+  }
+}
+
+void DimacsWriter::problem(const std::size_t variables,
+                           const std::size_t clauses) {
+  if (started) {
+    throw std::logic_error("DIMACS problem line has already been written");
+  }
+  const auto line = "p cnf " + std::to_string(variables) + " " +
+                    std::to_string(clauses) + "\n";
+  put(line.data(), line.size());
+  started   = true;
+  announced = clauses;
+}
+
+void DimacsWriter::addClause(const CnfBuilder::Literal* first,
+                             const CnfBuilder::Literal* last) {
+  if (!started) {
+    throw std::logic_error("DIMACS clauses have to follow the problem line");
+  }
+  // a literal, its sign and the separating space
+  std::array<char, 16U> text{};
+  for (const auto* it = first; it != last; ++it) {
+    auto* end = std::to_chars(text.data(), text.data() + text.size(), *it).ptr;
+    *end++    = ' ';
+    put(text.data(), static_cast<std::size_t>(end - text.data()));
+  }
+  put("0\n", 2U);
+  written++;
+}
+
+void DimacsWriter::finish() {
+  if (done) {
+    return;
+  }
+  done = true;
+  flush();
+#if QUSAT_HAS_ZLIB
+  if (gz != nullptr && gzclose(static_cast<gzFile>(gz)) != Z_OK) {
+    failed = true;
+  }
+  gz = nullptr;
+#endif
+  if (ownsFd) {
+    closeFile(fd);
+  }
+  if (failed) {
+    throw std::runtime_error("Could not write DIMACS file");
+  }
+  if (written != announced) {
+    throw std::runtime_error("DIMACS problem line announced " +
+                             std::to_string(announced) + " clauses, but " +
+                             std::to_string(written) + " were written");
+  }
+}
+
+void DimacsWriter::put(const char* data, const std::size_t size) {
+  buffer.insert(buffer.end(), data, data + size);
+  if (buffer.size() >= BUFFER_BYTES) {
+    flush();
+  }
+}
+
+void DimacsWriter::flush() {
+  if (buffer.empty() || failed) {
+    buffer.clear();
+    return;
+  }
+#if QUSAT_HAS_ZLIB
+  if (gz != nullptr) {
+    failed = gzwrite(static_cast<gzFile>(gz), buffer.data(),
+                     static_cast<unsigned>(buffer.size())) !=
+             static_cast<int>(buffer.size());
+    buffer.clear();
+    return;
+  }
+#endif
+  failed = !writeAll(fd, buffer.data(), buffer.size());
+  buffer.clear();
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "EquivalenceBatch.hpp"
+
+#include "Configuration.hpp"
+#include "SatEncoder.hpp"
+#include "Tableau.hpp"
+#include "ThreadPool.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+// jobs with the same inputs, whose distinct circuits are simulated together
+struct Group {
+  std::vector<std::string>                     inputs;
+  std::vector<std::size_t>                     circuits;
+  std::unordered_map<std::size_t, std::size_t> position; // in circuits
+  std::unique_ptr<SatEncoder>                  encoder;
+  std::string                                  error;
+  Interruption interruption = Interruption::None; // of the simulation
+  // largest time limit of its jobs in milliseconds, unless one has none
+  std::size_t                                  timeout = 0U;
+  bool                                         limited = true;
+  std::chrono::steady_clock::time_point        start; // of the simulation
+};
+} // namespace
+
+EquivalenceBatch::EquivalenceBatch(const Configuration& config)
+    : configuration(config) {}
+
+std::unique_ptr<SatEncoder> EquivalenceBatch::forkEncoder(
+    const SatEncoder&                               group,
+    std::vector<SatEncoder::CircuitRepresentation>& representations) {
+  auto encoder          = std::make_unique<SatEncoder>(group.configuration);
+  encoder->pool         = group.pool;
+  encoder->stats        = group.stats;
+  encoder->cancellation = group.cancellation;
+
+  std::unordered_map<std::size_t, std::size_t> ids;
+  const auto renumber = [&](const std::size_t id) {
+    auto it = ids.find(id);
+    if (it == ids.end()) {
+      const auto& table = group.generators;
+      const auto  local =
+          encoder->generators
+              .intern(Tableau::fromWords(table.words(id), table.qubits(id),
+                                         table.rows(id)))
+              .first;
+      it = ids.emplace(id, local).first;
+    }
+    return it->second;
+  };
+  // the input generators take the smallest ids, as in a separate check
+  for (auto& representation : representations) {
+    for (auto& id : representation.inputGenerators) {
+      id = renumber(id);
+    }
+  }
+  encoder->nrOfInputGenerators = encoder->generators.size();
+
+  encoder->stats.circuitDepth = 0U;
+  for (auto& representation : representations) {
+    for (auto& layer : representation.generatorMappings) {
+      std::map<std::size_t, std::size_t> renumbered;
+      for (const auto& [from, to] : layer) {
+        renumbered.emplace(renumber(from), renumber(to));
+      }
+      layer = std::move(renumbered);
+    }
+    for (auto& id : representation.outputGenerators) {
+      id = renumber(id);
+    }
+    encoder->stats.circuitDepth =
+        std::max(encoder->stats.circuitDepth, representation.levels);
+  }
+  return encoder;
+}
+
+std::vector<EquivalenceResult>
+EquivalenceBatch::run(const std::vector<EquivalenceJob>& jobs) {
+  if (!pool) {
+    pool = configuration.nThreads == 0U
+               ? ThreadPool::shared()
+               : std::make_shared<ThreadPool>(configuration.nThreads);
+  }
+  std::vector<EquivalenceResult> results(jobs.size());
+  const auto                     unitary =
+      configuration.equivalenceCheck == EquivalenceCheck::Unitary;
+
+  // distinct circuits, in the order they first appear in
+  std::unordered_map<const qc::QuantumComputation*, std::size_t> circuitIds;
+  std::vector<qc::QuantumComputation*>                           circuits;
+  std::vector<std::array<std::size_t, 2U>> jobCircuits(jobs.size());
+  for (std::size_t j = 0U; j < jobs.size(); j++) {
+    const std::array<qc::QuantumComputation*, 2U> pair{jobs[j].circuitOne,
+                                                       jobs[j].circuitTwo};
+    for (std::size_t k = 0U; k < pair.size(); k++) {
+      if (pair[k] == nullptr) {
+        results[j].error = "Job without circuit";
+        continue;
+      }
+      const auto [it, added] = circuitIds.emplace(pair[k], circuits.size());
+      if (added) {
+        circuits.emplace_back(pair[k]);
+      }
+      jobCircuits[j][k] = it->second;
+    }
+  }
+
+  // every circuit is checked once
+  std::vector<std::string> problems(circuits.size());
+  pool->parallelFor(circuits.size(), [&](const std::size_t c) {
+    if (!SatEncoder::isClifford(*circuits[c])) {
+      problems[c] = "Circuits are not Clifford circuits";
+    } else if (circuits[c]->empty()) {
+      problems[c] = "Both circuits must be non-empty";
+    }
+  });
+
+  // the unitary check ignores the inputs, so all its jobs form one group
+  std::map<std::vector<std::string>, std::size_t> groupIds;
+  std::vector<Group>                              groups;
+  std::vector<std::size_t>                        jobGroups(jobs.size());
+  for (std::size_t j = 0U; j < jobs.size(); j++) {
+    auto& error = results[j].error;
+    for (std::size_t k = 0U; k < 2U && error.empty(); k++) {
+      error = problems[jobCircuits[j][k]];
+    }
+    if (!error.empty()) {
+      continue;
+    }
+    const auto& inputs = unitary ? std::vector<std::string>{} : jobs[j].inputs;
+    const auto [it, added] = groupIds.emplace(inputs, groups.size());
+    if (added) {
+      groups.emplace_back().inputs = inputs;
+    }
+    jobGroups[j] = it->second;
+    auto& group  = groups[it->second];
+    const auto timeout =
+        jobs[j].timeout > 0U ? jobs[j].timeout : configuration.timeout;
+    group.limited = group.limited && timeout > 0U;
+    group.timeout = std::max(group.timeout, timeout);
+    for (const auto c : jobCircuits[j]) {
+      if (group.position.emplace(c, group.circuits.size()).second) {
+        group.circuits.emplace_back(c);
+      }
+    }
+  }
+
+  // simulate the circuits of every group together
+  std::vector<std::vector<SatEncoder::CircuitRepresentation>> representations(
+      groups.size());
+  pool->parallelFor(groups.size(), [&](const std::size_t g) {
+    auto& group                 = groups[g];
+    group.encoder               = std::make_unique<SatEncoder>(configuration);
+    group.encoder->pool         = pool;
+    group.encoder->cancellation = cancellation;
+    group.start                 = std::chrono::steady_clock::now();
+    // the simulation runs until the last of its jobs times out
+    if (group.limited) {
+      group.encoder->deadline =
+          group.start + std::chrono::milliseconds(group.timeout);
+    }
+    std::vector<const qc::QuantumComputation*> groupCircuits;
+    for (const auto c : group.circuits) {
+      groupCircuits.emplace_back(circuits[c]);
+    }
+    try {
+      representations[g] = group.encoder->preprocessCircuits(
+          groupCircuits, group.inputs, unitary);
+    } catch (const SatEncoder::Interrupted& e) {
+      group.interruption = e.reason;
+    } catch (const std::exception& e) {
+      group.error = e.what();
+    }
+  });
+
+  // decide every job with an encoder of its own
+  pool->parallelFor(jobs.size(), [&](const std::size_t j) {
+    auto&       result = results[j];
+    const auto& job    = jobs[j];
+    if (!result.error.empty()) {
+      return;
+    }
+    const auto& group = groups[jobGroups[j]];
+    if (!group.error.empty()) {
+      result.error = group.error;
+      return;
+    }
+    if (group.interruption != Interruption::None) {
+      result.stats              = group.encoder->stats;
+      result.stats.interruption = group.interruption;
+      return;
+    }
+    const auto timeout = job.timeout > 0U ? job.timeout : configuration.timeout;
+    const auto deadline = group.start + std::chrono::milliseconds(timeout);
+    if (timeout > 0U && std::chrono::steady_clock::now() >= deadline) {
+      // the shared simulation took longer than the job may
+      result.stats              = group.encoder->stats;
+      result.stats.interruption = Interruption::Timeout;
+      return;
+    }
+    std::vector<SatEncoder::CircuitRepresentation> pair;
+    for (const auto c : jobCircuits[j]) {
+      pair.emplace_back(representations[jobGroups[j]][group.position.at(c)]);
+    }
+    try {
+      const auto encoder = forkEncoder(*group.encoder, pair);
+      encoder->stats.nrOfDiffInputStates = job.inputs.size();
+      encoder->stats.nrOfQubits          = job.circuitOne->getNqubits();
+      if (timeout > 0U) {
+        encoder->deadline = deadline;
+      }
+      result.equivalent = encoder->decideEquivalence(pair, job.inputs);
+      result.stats      = encoder->stats;
+    } catch (const std::exception& e) {
+      result.error = e.what();
+    }
+  });
+  return results;
+}
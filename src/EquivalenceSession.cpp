@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "EquivalenceSession.hpp"
+
+#include "CnfBuilder.hpp"
+#include "Configuration.hpp"
+#include "Profile.hpp"
+#include "SatBackend.hpp"
+#include "SatEncoder.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+EquivalenceSession::EquivalenceSession(qc::QuantumComputation& circuitOne,
+                                       qc::QuantumComputation& circuitTwo,
+                                       const std::vector<std::string>& inputs,
+                                       const Configuration& configuration)
+    : encoder(configuration), candidates(inputs) {
+  if (!SatEncoder::isClifford(circuitOne) ||
+      !SatEncoder::isClifford(circuitTwo)) {
+    throw std::invalid_argument("Circuits are not Clifford circuits");
+  }
+  if (circuitOne.empty() || circuitTwo.empty()) {
+    throw std::invalid_argument("Both circuits must be non-empty");
+  }
+  auto& stats               = encoder.stats;
+  stats.nrOfDiffInputStates = inputs.size();
+  stats.nrOfQubits          = circuitOne.getNqubits();
+  stats.equivalenceCheck    = toString(EquivalenceCheck::Miter);
+  if (candidates.empty()) {
+    // the all-zero state
+    candidates.emplace_back(stats.nrOfQubits, 'I');
+  }
+
+  representations =
+      encoder.preprocessCircuits({&circuitOne, &circuitTwo}, candidates, false);
+
+  CnfBuilder cnf{};
+  const auto inputLevels =
+      encoder.constructMiterInstance(representations[0], representations[1],
+                                     cnf);
+  // s_g -> (common input = g) for every input generator g, and some s_g holds
+  for (const auto& inputLevel : inputLevels) {
+    const auto selector = cnf.newVariable();
+    cnf.addImplication({selector}, inputLevel);
+    selectors.emplace_back(selector);
+  }
+  cnf.addClause(selectors);
+
+  solver = SatBackend::create(configuration.backend);
+  solver->addCnf(cnf);
+  stats.satBackend = toString(solver->type());
+}
+
+bool EquivalenceSession::testEqual(const std::vector<std::size_t>& inputs) {
+  auto&      stats  = encoder.stats;
+  const auto before = std::chrono::high_resolution_clock::now();
+
+  // inputs with equal tableaus share their generator and its selector
+  const auto&       inputGenerators = representations[0].inputGenerators;
+  std::vector<bool> allowed(selectors.size(), false);
+  for (const auto input : inputs) {
+    allowed.at(inputGenerators.at(input)) = true;
+  }
+  for (std::size_t id = 0U; id < selectors.size(); id++) {
+    if (!allowed[id]) {
+      solver->assume(-selectors[id]);
+    }
+  }
+  encoder.armLimits();
+  solver->setLimits(encoder.solverLimits());
+  auto result = SatResult::Unknown;
+  {
+    QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::Solving);
+    result = solver->solve();
+  }
+  stats.satisfiable    = result == SatResult::Satisfiable;
+  stats.interruption   = result == SatResult::Unknown ? solver->interruption()
+                                                      : Interruption::None;
+  stats.equal          = !stats.satisfiable && stats.decided();
+  stats.counterexample = {};
+  if (stats.satisfiable) {
+    for (const auto input : inputs) {
+      if (solver->value(selectors[inputGenerators[input]])) {
+        encoder.recordCounterexample(representations[0], representations[1],
+                                     candidates, input);
+        break;
+      }
+    }
+  }
+
+  const auto after  = std::chrono::high_resolution_clock::now();
+  stats.solvingTime = static_cast<std::size_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(after - before)
+          .count());
+  stats.solverStatsMap = solver->statistics();
+  return stats.equal;
+}
+
+bool EquivalenceSession::testEqual(const std::vector<std::string>& inputs) {
+  std::vector<std::size_t> indices;
+  indices.reserve(inputs.size());
+  for (const auto& input : inputs) {
+    const auto it = std::find(candidates.begin(), candidates.end(), input);
+    if (it == candidates.end()) {
+      throw std::invalid_argument("Input " + input +
+                                  " is not among the inputs of the session");
+    }
+    indices.emplace_back(static_cast<std::size_t>(it - candidates.begin()));
+  }
+  return testEqual(indices);
+}
+
+bool EquivalenceSession::testEqual() {
+  std::vector<std::size_t> indices(candidates.size());
+  std::iota(indices.begin(), indices.end(), 0U);
+  return testEqual(indices);
+}
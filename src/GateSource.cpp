@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "GateSource.hpp"
+
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/Operation.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <istream>
+#include <limits>
+#include <map>
+#include <optional>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+bool isSingleQubitClifford(const qc::OpType type) {
+  return type == qc::OpType::I || type == qc::OpType::H ||
+         type == qc::OpType::S || type == qc::OpType::Sdg ||
+         type == qc::OpType::X || type == qc::OpType::Y ||
+         type == qc::OpType::Z || type == qc::OpType::SX ||
+         type == qc::OpType::SXdg || type == qc::OpType::V ||
+         type == qc::OpType::Vdg;
+}
+
+bool isControllablePauli(const qc::OpType type) {
+  return type == qc::OpType::X || type == qc::OpType::Y ||
+         type == qc::OpType::Z;
+}
+
+std::string trim(const std::string& text) {
+  const auto isSpace = [](const unsigned char c) { return std::isspace(c); };
+  const auto first   = std::find_if_not(text.begin(), text.end(), isSpace);
+  const auto last =
+      std::find_if_not(text.rbegin(), text.rend(), isSpace).base();
+  return first < last ? std::string(first, last) : std::string{};
+}
+} // namespace
+
+bool CircuitGateSource::isSupported(const qc::Operation& op) {
+  const auto type = op.getType();
+  if (!op.isStandardOperation()) {
+    return false;
+  }
+  if (isTwoTargetClifford(type)) {
+    return op.getTargets().size() == 2U && !op.isControlled();
+  }
+  if (!isSingleQubitClifford(type) || op.getTargets().size() != 1U) {
+    return false;
+  }
+  if (!op.isControlled()) {
+    return true;
+  }
+  const auto& controls = op.getControls();
+  return isControllablePauli(type) && controls.size() == 1U &&
+         controls.begin()->type == qc::Control::Type::Pos;
+}
+
+CliffordGate CircuitGateSource::toGate(const qc::Operation& op) {
+  if (!isSupported(op)) {
+    throw std::invalid_argument("Operation of type " +
+                                qc::toString(op.getType()) +
+                                " is not a supported Clifford gate");
+  }
+  const auto& targets = op.getTargets();
+  if (isTwoTargetClifford(op.getType())) {
+    return {op.getType(), targets[1], targets[0], false};
+  }
+  if (!op.isControlled()) {
+    return {op.getType(), targets.front(), 0U, false};
+  }
+  return {op.getType(), targets.front(), op.getControls().begin()->qubit, true};
+}
+
+std::optional<CliffordGate> CircuitGateSource::next() {
+  if (current == last) {
+    return std::nullopt;
+  }
+  return toGate(**(current++));
+}
+
+QasmGateSource::QasmGateSource(const std::string& path)
+    : file(path), in(&file) {
+  if (!file.good()) {
+    throw std::invalid_argument("Could not open " + path);
+  }
+  readDeclarations();
+}
+
+QasmGateSource::QasmGateSource(std::istream& stream) : in(&stream) {
+  readDeclarations();
+}
+
+void QasmGateSource::readDeclarations() {
+  for (auto statement = readStatement(); !statement.empty();
+       statement       = readStatement()) {
+    if (!declare(statement)) {
+      lookahead = std::move(statement);
+      return;
+    }
+  }
+}
+
+std::string QasmGateSource::readStatement() {
+  std::string statement;
+  char        c = 0;
+  while (in->get(c)) {
+    if (c == '/' && (in->peek() == '/' || in->peek() == '*')) {
+      if (in->get() == '/') {
+        in->ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+      } else {
+        char prev = 0;
+        while (in->get(c) && !(prev == '*' && c == '/')) {
+          prev = c;
+        }
+      }
+      statement += ' ';
+      continue;
+    }
+    if (c == ';') {
+      statement = trim(statement);
+      if (!statement.empty()) {
+        return statement;
+      }
+      continue;
+    }
+    statement += c;
+  }
+  if (!trim(statement).empty()) {
+    throw std::invalid_argument("Unterminated statement: " + trim(statement));
+  }
+  return {};
+}
+
+bool QasmGateSource::declare(const std::string& statement) {
+  static const std::regex ignored(R"((OPENQASM|include|creg|bit)\b.*)");
+  static const std::regex qreg(R"(qreg\s+(\w+)\s*\[\s*(\d+)\s*\])");
+  static const std::regex qubit(R"(qubit\s*(?:\[\s*(\d+)\s*\])?\s+(\w+))");
+  std::smatch             match;
+  if (std::regex_match(statement, ignored)) {
+    return true;
+  }
+  std::string name;
+  std::size_t size = 1U;
+  if (std::regex_match(statement, match, qreg)) {
+    name = match[1];
+    size = std::stoul(match[2]);
+  } else if (std::regex_match(statement, match, qubit)) {
+    name = match[2];
+    if (match[1].matched) {
+      size = std::stoul(match[1]);
+    }
+  } else {
+    return false;
+  }
+  if (!registers.emplace(name, Register{nrOfQubits, size}).second) {
+    throw std::invalid_argument("Register " + name + " is declared twice");
+  }
+  nrOfQubits += size;
+  return true;
+}
+
+std::vector<std::size_t>
+QasmGateSource::operandQubits(const std::string& operand) const {
+  const auto bracket = operand.find('[');
+  const auto name    = trim(operand.substr(0U, bracket));
+  const auto reg     = registers.find(name);
+  if (reg == registers.end()) {
+    throw std::invalid_argument("Unknown register " + name);
+  }
+  const auto& [offset, size] = reg->second;
+  if (bracket == std::string::npos) {
+    std::vector<std::size_t> qubits(size);
+    for (std::size_t i = 0U; i < size; i++) {
+      qubits[i] = offset + i;
+    }
+    return qubits;
+  }
+  const auto index = std::stoul(operand.substr(bracket + 1U));
+  if (index >= size) {
+    throw std::invalid_argument("Qubit " + trim(operand) + " is out of range");
+  }
+  return {offset + index};
+}
+
+void QasmGateSource::expand(const std::string& statement) {
+  const auto end =
+      std::find_if(statement.begin(), statement.end(),
+                   [](const unsigned char c) { return std::isspace(c); });
+  const std::string name(statement.begin(), end);
+  if (name == "barrier") {
+    return;
+  }
+  static const std::map<std::string, qc::OpType> singleQubitGates{
+      {"id", qc::OpType::I},     {"h", qc::OpType::H},
+      {"s", qc::OpType::S},      {"sdg", qc::OpType::Sdg},
+      {"x", qc::OpType::X},      {"y", qc::OpType::Y},
+      {"z", qc::OpType::Z},      {"sx", qc::OpType::SX},
+      {"sxdg", qc::OpType::SXdg}};
+  // the first operand is the control, or the first target
+  static const std::map<std::string, qc::OpType> twoQubitGates{
+      {"cx", qc::OpType::X},            {"CX", qc::OpType::X},
+      {"cy", qc::OpType::Y},            {"cz", qc::OpType::Z},
+      {"swap", qc::OpType::SWAP},       {"iswap", qc::OpType::iSWAP},
+      {"iswapdg", qc::OpType::iSWAPdg}, {"dcx", qc::OpType::DCX},
+      {"ecr", qc::OpType::ECR}};
+  const auto single = singleQubitGates.find(name);
+  const auto pair   = twoQubitGates.find(name);
+  if (single == singleQubitGates.end() && pair == twoQubitGates.end()) {
+    throw std::invalid_argument("Unsupported statement: " + statement);
+  }
+
+  std::vector<std::vector<std::size_t>> operands;
+  const std::string                     rest(end, statement.end());
+  for (std::size_t first = 0U; first <= rest.size();) {
+    const auto comma = std::min(rest.find(',', first), rest.size());
+    operands.emplace_back(operandQubits(rest.substr(first, comma - first)));
+    first = comma + 1U;
+  }
+  const auto twoQubit = pair != twoQubitGates.end();
+  if (operands.size() != (twoQubit ? 2U : 1U)) {
+    throw std::invalid_argument("Wrong number of operands: " + statement);
+  }
+
+  if (!twoQubit) {
+    for (const auto target : operands.front()) {
+      pending.push_back({single->second, target, 0U, false});
+    }
+    return;
+  }
+  // registers as operands apply the gate to every pair of their qubits
+  const auto  type       = pair->second;
+  const auto  controlled = !isTwoTargetClifford(type);
+  const auto& controls   = operands[0];
+  const auto& targets    = operands[1];
+  const auto  count      = std::max(controls.size(), targets.size());
+  if ((controls.size() != count && controls.size() != 1U) ||
+      (targets.size() != count && targets.size() != 1U)) {
+    throw std::invalid_argument("Registers of different sizes: " + statement);
+  }
+  for (std::size_t i = 0U; i < count; i++) {
+    const auto target  = targets[targets.size() == 1U ? 0U : i];
+    const auto control = controls[controls.size() == 1U ? 0U : i];
+    if (target == control) {
+      throw std::invalid_argument("Gate acts twice on a qubit: " + statement);
+    }
+    pending.push_back({type, target, control, controlled});
+  }
+}
+
+std::optional<CliffordGate> QasmGateSource::next() {
+  while (pending.empty()) {
+    auto statement = lookahead.empty() ? readStatement() : std::move(lookahead);
+    lookahead.clear();
+    if (statement.empty()) {
+      return std::nullopt;
+    }
+    if (statement.rfind("qreg", 0U) == 0U ||
+        statement.rfind("qubit", 0U) == 0U) {
+      throw std::invalid_argument(
+          "Qubits must be declared before the first gate: " + statement);
+    }
+    if (!declare(statement)) {
+      expand(statement);
+    }
+  }
+  const auto gate = pending.front();
+  pending.pop_front();
+  return gate;
+}
+
+namespace {
+// moves every gate of the levels, the last one first, to the last level it
+// can reach without passing a gate it does not commute with
+void delayGates(std::vector<std::vector<CliffordGate>>& levels,
+                const std::size_t                       qubits) {
+  // levels of the gates on every qubit, and whether they are diagonal on it
+  std::vector<std::map<std::size_t, bool>> placed(qubits);
+  const auto forEachQubit = [](const CliffordGate& gate, const auto& body) {
+    body(static_cast<std::size_t>(gate.target));
+    if (gate.twoQubit()) {
+      body(static_cast<std::size_t>(gate.control));
+    }
+  };
+  for (std::size_t l = 0U; l < levels.size(); l++) {
+    for (const auto& gate : levels[l]) {
+      forEachQubit(gate, [&](const std::size_t q) {
+        placed[q][l] = LevelScheduler::diagonal(gate, q);
+      });
+    }
+  }
+  for (std::size_t l = levels.size(); l-- > 0U;) {
+    auto remaining = std::move(levels[l]);
+    levels[l].clear();
+    for (const auto& gate : remaining) {
+      auto last = levels.size() - 1U;
+      forEachQubit(gate, [&](const std::size_t q) {
+        const auto diagonal = LevelScheduler::diagonal(gate, q);
+        for (auto it = placed[q].upper_bound(l);
+             it != placed[q].end() && it->first <= last; ++it) {
+          if (!diagonal || !it->second) {
+            last = it->first - 1U;
+            break;
+          }
+        }
+      });
+      // the latest level in reach in which all qubits of the gate are free
+      const auto free = [&](const std::size_t level) {
+        bool result = true;
+        forEachQubit(gate, [&](const std::size_t q) {
+          result = result && placed[q].count(level) == 0U;
+        });
+        return result;
+      };
+      while (last > l && !free(last)) {
+        last--;
+      }
+      forEachQubit(gate, [&](const std::size_t q) {
+        placed[q][last] = placed[q][l];
+        if (last != l) {
+          placed[q].erase(l);
+        }
+      });
+      levels[last].push_back(gate);
+    }
+  }
+  // levels whose gates have all moved on are dropped
+  levels.erase(std::remove_if(levels.begin(), levels.end(),
+                              [](const auto& level) { return level.empty(); }),
+               levels.end());
+}
+} // namespace
+
+std::string toString(const LevelScheduling scheduling) {
+  switch (scheduling) {
+  case LevelScheduling::AsSoonAsPossible:
+    return "asap";
+  case LevelScheduling::AsLateAsPossible:
+    return "alap";
+  }
+  return "unknown";
+}
+
+LevelScheduling levelSchedulingFromString(const std::string& name) {
+  if (name == "asap") {
+    return LevelScheduling::AsSoonAsPossible;
+  }
+  if (name == "alap") {
+    return LevelScheduling::AsLateAsPossible;
+  }
+  throw std::invalid_argument("Unknown level scheduling: " + name);
+}
+
+LevelScheduler::LevelScheduler(const std::size_t qubits) : state(qubits) {}
+
+bool LevelScheduler::diagonal(const CliffordGate& gate,
+                              const std::size_t   qubit) {
+  if (isTwoTargetClifford(gate.type)) {
+    return false;
+  }
+  if (gate.controlled && qubit == gate.control) {
+    return true;
+  }
+  return gate.type == qc::OpType::I || gate.type == qc::OpType::Z ||
+         gate.type == qc::OpType::S || gate.type == qc::OpType::Sdg;
+}
+
+std::size_t LevelScheduler::lowest(const CliffordGate& gate,
+                                   const std::size_t   qubit) const {
+  const auto& q = state[qubit];
+  return diagonal(gate, qubit) ? q.barrier : q.end;
+}
+
+bool LevelScheduler::taken(const std::size_t qubit,
+                           const std::size_t level) const {
+  const auto& diagonals = state[qubit].diagonals;
+  return std::binary_search(diagonals.begin(), diagonals.end(), level);
+}
+
+std::size_t LevelScheduler::earliest(const CliffordGate& gate,
+                                     const std::size_t   from) const {
+  auto level = std::max(from, lowest(gate, gate.target));
+  if (gate.twoQubit()) {
+    level = std::max(level, lowest(gate, gate.control));
+  }
+  // only diagonal gates have been placed from the lowest level on
+  while (taken(gate.target, level) ||
+         (gate.twoQubit() && taken(gate.control, level))) {
+    level++;
+  }
+  return level;
+}
+
+void LevelScheduler::place(const CliffordGate& gate, const std::size_t level) {
+  const auto placeOn = [&](const std::size_t qubit) {
+    auto& q = state[qubit];
+    if (!diagonal(gate, qubit)) {
+      q.barrier = level + 1U;
+      q.end     = level + 1U;
+      q.diagonals.clear();
+      return;
+    }
+    auto& diagonals = q.diagonals;
+    diagonals.erase(diagonals.begin(),
+                    std::lower_bound(diagonals.begin(), diagonals.end(),
+                                     std::max(closed, q.barrier)));
+    diagonals.insert(
+        std::lower_bound(diagonals.begin(), diagonals.end(), level), level);
+    q.end = std::max(q.end, level + 1U);
+  };
+  placeOn(gate.target);
+  if (gate.twoQubit()) {
+    placeOn(gate.control);
+  }
+}
+
+std::vector<std::vector<CliffordGate>>
+scheduleLevels(const std::vector<CliffordGate>& gates, const std::size_t qubits,
+               const LevelScheduling scheduling) {
+  LevelScheduler                         scheduler(qubits);
+  std::vector<std::vector<CliffordGate>> levels;
+  for (const auto& gate : gates) {
+    if (gate.target >= qubits || (gate.twoQubit() && gate.control >= qubits)) {
+      throw std::invalid_argument("Gate acts on a qubit beyond the circuit");
+    }
+    if (gate.type == qc::OpType::I) { // leaves every tableau unchanged
+      continue;
+    }
+    const auto level = scheduler.earliest(gate, 0U);
+    if (levels.size() <= level) {
+      levels.resize(level + 1U);
+    }
+    levels[level].push_back(gate);
+    scheduler.place(gate, level);
+  }
+  if (scheduling == LevelScheduling::AsLateAsPossible) {
+    delayGates(levels, qubits);
+  }
+  return levels;
+}
+
+LevelStream::LevelStream(GateSource&       gateSource,
+                         const std::size_t levelWindow)
+    : source(gateSource), window(std::max<std::size_t>(levelWindow, 1U)),
+      scheduler(gateSource.qubits()) {}
+
+void LevelStream::pop(std::vector<CliffordGate>& level) {
+  level = std::move(open.front());
+  open.pop_front();
+  base++;
+  scheduler.close(base);
+}
+
+bool LevelStream::next(std::vector<CliffordGate>& level) {
+  while (true) {
+    if (!pending && !exhausted) {
+      pending = source.next();
+      if (!pending) {
+        exhausted = true;
+      } else {
+        nrOfGates++;
+      }
+    }
+    if (!pending) {
+      if (open.empty()) {
+        return false;
+      }
+      pop(level);
+      return true;
+    }
+
+    const auto& gate = *pending;
+    if (gate.target >= scheduler.qubits() ||
+        (gate.twoQubit() && gate.control >= scheduler.qubits())) {
+      throw std::invalid_argument("Gate acts on a qubit beyond the circuit");
+    }
+    if (gate.type == qc::OpType::I) { // leaves every tableau unchanged
+      pending.reset();
+      continue;
+    }
+    const auto target = scheduler.earliest(gate, base);
+    if (target - base >= window) {
+      // the oldest level is closed for good to make room
+      pop(level);
+      return true;
+    }
+    while (open.size() <= target - base) {
+      open.emplace_back();
+    }
+    open[target - base].push_back(gate);
+    scheduler.place(gate, target);
+    pending.reset();
+  }
+}
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "GeneratorCache.hpp"
+
+#include "GateSource.hpp"
+#include "GeneratorTable.hpp"
+#include "Hashing.hpp"
+#include "Tableau.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef _WIN32
+#include <fstream>
+#else
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+using hashing::checksum;
+using hashing::mix;
+using hashing::ORDER_MARK;
+
+// file header: magic, version, byte order mark
+constexpr std::uint64_t FILE_MAGIC   = 0x0043475441535551ULL; // "QUSATGC"
+constexpr std::size_t   HEADER_WORDS = 3U;
+// record framing: marker, number of payload words, checksum of the payload
+constexpr std::uint64_t RECORD_MAGIC = 0x31434552474b4351ULL; // "QCKGREC1"
+constexpr std::size_t   FRAME_WORDS  = 3U;
+// payload: qubits, rows, words per generator, generators, inputs, levels and
+// the input key, followed by the level keys, the chains and the generators
+constexpr std::size_t FIXED_WORDS = 8U;
+
+void absorb(GeneratorCache::Key& key, const std::uint64_t value) {
+  key.lo = mix(key.lo ^ value);
+  key.hi = mix(key.hi + (value * 0xc2b2ae3d27d4eb4fULL) + 1U);
+}
+
+std::size_t chainOffset(const std::uint64_t* payload) {
+  return FIXED_WORDS + (2U * payload[5]);
+}
+
+std::size_t generatorOffset(const std::uint64_t* payload) {
+  return chainOffset(payload) + ((payload[5] + 1U) * payload[4]);
+}
+
+// whether the payload of `count` words is consistent with its sizes
+bool wellFormed(const std::uint64_t* payload, const std::size_t count) {
+  if (count < FIXED_WORDS) {
+    return false;
+  }
+  const auto generators = payload[3];
+  const auto inputs     = payload[4];
+  const auto levels     = payload[5];
+  // the sizes are bounded by the payload, so the products below cannot wrap
+  if (levels > count || inputs > count || generators > count ||
+      payload[2] > count ||
+      generatorOffset(payload) + (generators * payload[2]) != count) {
+    return false;
+  }
+  const auto* chains = payload + chainOffset(payload);
+  return std::all_of(chains, chains + ((levels + 1U) * inputs),
+                     [&](const std::uint64_t id) { return id < generators; });
+}
+} // namespace
+
+GeneratorCache::Key
+GeneratorCache::Record::levelKey(const std::size_t level) const {
+  const auto* key = data + FIXED_WORDS + (2U * level);
+  return {key[0], key[1]};
+}
+
+const std::uint64_t*
+GeneratorCache::Record::generator(const std::size_t levels,
+                                  const std::size_t input) const {
+  const auto id = data[chainOffset(data) + (levels * inputs()) + input];
+  return data + generatorOffset(data) + (id * data[2]);
+}
+
+GeneratorCache::GeneratorCache(const std::string& file) : path(file) {
+  const std::vector<std::uint64_t> header{FILE_MAGIC, VERSION, ORDER_MARK};
+#ifdef _WIN32
+  std::fstream stream(path, std::ios::binary | std::ios::in | std::ios::out |
+                                std::ios::app);
+  if (!stream) {
+    throw std::runtime_error("Could not open generator cache " + path);
+  }
+  stream.seekg(0, std::ios::end);
+  if (stream.tellg() == 0) {
+    stream.write(reinterpret_cast<const char*>(header.data()),
+                 static_cast<std::streamsize>(header.size() * 8U));
+  }
+#else
+  fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_APPEND, 0644);
+  if (fd < 0) {
+    throw std::runtime_error("Could not open generator cache " + path);
+  }
+  // the first process to lock the empty file writes the header
+  ::flock(fd, LOCK_EX);
+  struct stat status{};
+  if (::fstat(fd, &status) == 0 && status.st_size == 0) {
+    const std::size_t bytes = header.size() * 8U;
+    if (::write(fd, header.data(), bytes) != static_cast<ssize_t>(bytes)) {
+      std::cerr << "Could not initialize generator cache " << path
+                << std::endl;
+    }
+  }
+  ::flock(fd, LOCK_UN);
+#endif
+  mapFile();
+  if (compatible) {
+    indexRecords();
+  } else {
+    std::cerr << "Ignoring generator cache " << path
+              << " in an unsupported format" << std::endl;
+  }
+}
+
+GeneratorCache::~GeneratorCache() {
+#ifndef _WIN32
+  if (base != nullptr && contents.empty()) {
+    ::munmap(const_cast<std::uint64_t*>(base), mappedWords * 8U);
+  }
+  if (fd >= 0) {
+    ::close(fd);
+  }
+#endif
+}
+
+void GeneratorCache::mapFile() {
+#ifdef _WIN32
+  std::ifstream stream(path, std::ios::binary | std::ios::ate);
+  const auto    bytes = static_cast<std::size_t>(stream.tellg());
+  contents.resize(bytes / 8U);
+  stream.seekg(0);
+  stream.read(reinterpret_cast<char*>(contents.data()),
+              static_cast<std::streamsize>(contents.size() * 8U));
+  base        = contents.data();
+  mappedWords = contents.size();
+#else
+  struct stat status{};
+  if (::fstat(fd, &status) != 0) {
+    return;
+  }
+  // a torn write may leave a partial word at the end, which is not mapped
+  mappedWords = static_cast<std::size_t>(status.st_size) / 8U;
+  if (mappedWords < HEADER_WORDS) {
+    mappedWords = 0U;
+    return;
+  }
+  void* mapped =
+      ::mmap(nullptr, mappedWords * 8U, PROT_READ, MAP_SHARED, fd, 0);
+  if (mapped == MAP_FAILED) {
+    mappedWords = 0U;
+    return;
+  }
+  base = static_cast<const std::uint64_t*>(mapped);
+#endif
+  compatible = mappedWords >= HEADER_WORDS && base[0] == FILE_MAGIC &&
+               base[1] == VERSION && base[2] == ORDER_MARK;
+}
+
+void GeneratorCache::indexRecords() {
+  std::size_t pos = HEADER_WORDS;
+  while (pos + FRAME_WORDS <= mappedWords) {
+    const auto* frame = base + pos;
+    const auto  count = frame[1];
+    // records that are torn or still being written fail one of the checks,
+    // the scan then continues with the next word to find the next marker
+    if (frame[0] != RECORD_MAGIC ||
+        count > mappedWords - pos - FRAME_WORDS ||
+        checksum(frame + FRAME_WORDS, count) != frame[2] ||
+        !wellFormed(frame + FRAME_WORDS, count)) {
+      pos++;
+      continue;
+    }
+    records.emplace(frame[FRAME_WORDS + 6U], pos + FRAME_WORDS);
+    pos += FRAME_WORDS + count;
+  }
+}
+
+GeneratorCache::Key
+GeneratorCache::inputKey(const std::vector<const Tableau*>& inputs) {
+  Key key{mix(inputs.size()), mix(~inputs.size())};
+  for (const auto* input : inputs) {
+    const auto& fingerprint = input->fingerprint();
+    absorb(key, fingerprint.lo);
+    absorb(key, fingerprint.hi);
+  }
+  return key;
+}
+
+GeneratorCache::Key
+GeneratorCache::levelKey(const Key&                       previous,
+                         const std::vector<CliffordGate>& level) {
+  auto key = previous;
+  absorb(key, level.size());
+  for (const auto& gate : level) {
+    absorb(key, static_cast<std::uint64_t>(gate.type));
+    absorb(key, gate.target);
+    absorb(key, gate.twoQubit() ? gate.control + 1U : 0U);
+  }
+  return key;
+}
+
+std::vector<GeneratorCache::Record>
+GeneratorCache::find(const Key&                         key,
+                     const std::vector<const Tableau*>& inputs) const {
+  std::vector<Record> found;
+  if (inputs.empty()) {
+    return found;
+  }
+  const auto [first, last] = records.equal_range(key.lo);
+  for (auto it = first; it != last; ++it) {
+    const Record record(base + it->second);
+    const auto&  front = *inputs.front();
+    if (record.data[7] != key.hi || record.inputs() != inputs.size() ||
+        record.qubits() != front.qubits() || record.rows() != front.rows() ||
+        record.data[2] != front.raw().size()) {
+      continue;
+    }
+    // the key only selects the record, the inputs have to match exactly
+    bool equal = true;
+    for (std::size_t i = 0U; i < inputs.size() && equal; i++) {
+      const auto& raw = inputs[i]->raw();
+      equal = std::equal(raw.begin(), raw.end(), record.generator(0U, i));
+    }
+    if (equal) {
+      found.push_back(record);
+    }
+  }
+  return found;
+}
+
+void GeneratorCache::store(const Key& key, const std::vector<Key>& levelKeys,
+                           const std::vector<std::vector<std::size_t>>& chains,
+                           const GeneratorTable& table) {
+  if (!compatible || chains.empty()) {
+    return;
+  }
+  const auto first  = chains.front().front();
+  const auto levels = levelKeys.size();
+  const auto inputs = chains.size();
+
+  // generators of the record, numbered in order of appearance
+  std::unordered_map<std::size_t, std::size_t> local;
+  std::vector<std::size_t>                     global;
+  std::vector<std::uint64_t> payload{table.qubits(first),
+                                     table.rows(first),
+                                     table.wordCount(first),
+                                     0U,
+                                     inputs,
+                                     levels,
+                                     key.lo,
+                                     key.hi};
+  for (const auto& levelKey : levelKeys) {
+    payload.push_back(levelKey.lo);
+    payload.push_back(levelKey.hi);
+  }
+  for (std::size_t l = 0U; l <= levels; l++) {
+    for (const auto& chain : chains) {
+      const auto [it, added] = local.emplace(chain.at(l), global.size());
+      if (added) {
+        global.push_back(chain[l]);
+      }
+      payload.push_back(it->second);
+    }
+  }
+  payload[3] = global.size();
+  for (const auto id : global) {
+    const auto* words = table.words(id);
+    payload.insert(payload.end(), words, words + table.wordCount(id));
+  }
+
+  std::vector<std::uint64_t> record{RECORD_MAGIC, payload.size(),
+                                    checksum(payload.data(), payload.size())};
+  record.insert(record.end(), payload.begin(), payload.end());
+  const auto bytes = record.size() * 8U;
+#ifdef _WIN32
+  std::ofstream stream(path, std::ios::binary | std::ios::app);
+  stream.seekp(0, std::ios::end);
+  const auto partial = static_cast<std::size_t>(stream.tellp()) % 8U;
+  if (partial != 0U) {
+    const std::uint64_t padding = 0U;
+    stream.write(reinterpret_cast<const char*>(&padding),
+                 static_cast<std::streamsize>(8U - partial));
+  }
+  stream.write(reinterpret_cast<const char*>(record.data()),
+               static_cast<std::streamsize>(bytes));
+#else
+  ::flock(fd, LOCK_EX);
+  // realign after a write torn by a crash, records start at word boundaries
+  struct stat status{};
+  if (::fstat(fd, &status) == 0 && status.st_size % 8 != 0) {
+    const std::uint64_t padding = 0U;
+    const auto missing = 8U - static_cast<std::size_t>(status.st_size % 8);
+    if (::write(fd, &padding, missing) < 0) {
+      ::flock(fd, LOCK_UN);
+      return;
+    }
+  }
+  const auto* data    = reinterpret_cast<const char*>(record.data());
+  std::size_t written = 0U;
+  while (written < bytes) {
+    const auto result = ::write(fd, data + written, bytes - written);
+    if (result <= 0) {
+      std::cerr << "Could not write to generator cache " << path << std::endl;
+      break;
+    }
+    written += static_cast<std::size_t>(result);
+  }
+  ::flock(fd, LOCK_UN);
+#endif
+}
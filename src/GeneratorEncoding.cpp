@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "GeneratorEncoding.hpp"
+
+#include "CnfBuilder.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+std::string toString(const EncodingType type) {
+  switch (type) {
+  case EncodingType::Binary:
+    return "binary";
+  case EncodingType::OneHot:
+    return "onehot";
+  case EncodingType::Order:
+    return "order";
+  }
+  return "unknown";
+}
+
+EncodingType encodingFromString(const std::string& name) {
+  if (name == "binary") {
+    return EncodingType::Binary;
+  }
+  if (name == "onehot") {
+    return EncodingType::OneHot;
+  }
+  if (name == "order") {
+    return EncodingType::Order;
+  }
+  throw std::invalid_argument("Unknown generator encoding: " + name);
+}
+
+GeneratorEncoding::GeneratorEncoding(const EncodingType encodingType,
+                                     const std::size_t  nrOfGenerators)
+    : encoding(encodingType), generators(nrOfGenerators) {
+  // bitwidth required to encode the generators
+  while ((std::uint64_t{1} << bitwidth) < generators) {
+    bitwidth++;
+  }
+  if (bitwidth < 1U) {
+    bitwidth = 1U;
+  }
+}
+
+std::vector<GeneratorEncoding::Literal>
+GeneratorEncoding::newLevel(CnfBuilder& cnf) const {
+  switch (encoding) {
+  case EncodingType::OneHot: {
+    auto level = cnf.newVariables(generators);
+    cnf.addClause(level);
+    cnf.addAtMostOne(level);
+    return level;
+  }
+  case EncodingType::Order: {
+    auto level = cnf.newVariables(generators - 1U);
+    for (std::size_t k = 1U; k < level.size(); k++) {
+      cnf.addClause({-level[k], level[k - 1U]});
+    }
+    return level;
+  }
+  default: {
+    auto level = cnf.newVariables(bitwidth);
+    // block ids >= G if the number of generators is no power of two
+    cnf.addLessThan(level, generators);
+    return level;
+  }
+  }
+}
+
+std::vector<GeneratorEncoding::Literal>
+GeneratorEncoding::equals(const std::vector<Literal>& level,
+                          const std::size_t           id) const {
+  switch (encoding) {
+  case EncodingType::OneHot:
+    return {level[id]};
+  case EncodingType::Order: {
+    // level[k - 1] states id >= k
+    std::vector<Literal> result{};
+    if (id > 0U) {
+      result.emplace_back(level[id - 1U]);
+    }
+    if (id < level.size()) {
+      result.emplace_back(-level[id]);
+    }
+    return result;
+  }
+  default:
+    return CnfBuilder::equals(level, id);
+  }
+}
+
+void GeneratorEncoding::addLessThan(CnfBuilder&                 cnf,
+                                    const std::vector<Literal>& level,
+                                    const std::size_t           bound) const {
+  if (bound >= generators) {
+    return; // already guaranteed by the domain of the level
+  }
+  if (bound == 0U) {
+    cnf.addClause({});
+    return;
+  }
+  switch (encoding) {
+  case EncodingType::OneHot:
+    for (std::size_t id = bound; id < generators; id++) {
+      cnf.addClause({-level[id]});
+    }
+    break;
+  case EncodingType::Order:
+    cnf.addClause({-level[bound - 1U]});
+    break;
+  default:
+    cnf.addLessThan(level, bound);
+    break;
+  }
+}
+
+void GeneratorEncoding::addEqual(CnfBuilder&                 cnf,
+                                 const std::vector<Literal>& lhs,
+                                 const std::vector<Literal>& rhs) const {
+  // in all encodings equal ids correspond to equal variable assignments
+  cnf.addEqual(lhs, rhs);
+}
+
+void GeneratorEncoding::addNotEqual(CnfBuilder&                 cnf,
+                                    const std::vector<Literal>& lhs,
+                                    const std::vector<Literal>& rhs) const {
+  if (encoding == EncodingType::OneHot) {
+    // exactly one variable of each level is true, they must not coincide
+    for (std::size_t id = 0U; id < lhs.size(); id++) {
+      cnf.addClause({-lhs[id], -rhs[id]});
+    }
+    return;
+  }
+  cnf.addNotEqual(lhs, rhs);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "GeneratorTable.hpp"
+
+#include "Tableau.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+std::pair<std::size_t, bool> GeneratorTable::intern(const Tableau& tableau) {
+  if (const auto id = find(tableau); id.has_value()) {
+    return {*id, false};
+  }
+  const auto& raw = tableau.raw();
+  const auto  id  = slots.size();
+  slots.push_back(
+      {arena.size(), raw.size(), tableau.qubits(), tableau.rows()});
+  arena.insert(arena.end(), raw.begin(), raw.end());
+  index.emplace(tableau.fingerprint(), id);
+  return {id, true};
+}
+
+std::optional<std::size_t>
+GeneratorTable::find(const Tableau& tableau) const {
+  const auto& raw          = tableau.raw();
+  const auto [first, last] = index.equal_range(tableau.fingerprint());
+  for (auto it = first; it != last; ++it) {
+    const auto& slot = slots[it->second];
+    if (slot.qubits == tableau.qubits() && slot.rows == tableau.rows() &&
+        slot.size == raw.size() &&
+        std::equal(raw.begin(), raw.end(),
+                   arena.begin() + static_cast<std::ptrdiff_t>(slot.offset))) {
+      return it->second;
+    }
+  }
+  return std::nullopt;
+}
+
+std::vector<std::vector<bool>>
+GeneratorTable::toGenerator(const std::size_t id) const {
+  const auto& slot = slots.at(id);
+  const auto  n    = slot.qubits;
+  const auto  w = (slot.rows + Tableau::WORD_BITS - 1U) / Tableau::WORD_BITS;
+  const auto* data = words(id);
+
+  std::vector<std::vector<bool>> result(slot.rows,
+                                        std::vector<bool>((2U * n) + 1U));
+  for (std::size_t column = 0U; column <= 2U * n; column++) {
+    for (std::size_t row = 0U; row < slot.rows; row++) {
+      result[row][column] = ((data[(column * w) + (row / Tableau::WORD_BITS)] >>
+                              (row % Tableau::WORD_BITS)) &
+                             1U) != 0U;
+    }
+  }
+  return result;
+}
+
+void GeneratorTable::clear() {
+  index.clear();
+  slots.clear();
+  arena.clear();
+}
@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+// Hashing shared by the fingerprints of the tableaus and the on-disk formats
+// of the generator cache and the binary files. The checksums and the byte
+// order mark are part of both formats, changing them requires new versions.
+
+#include <cstddef>
+#include <cstdint>
+
+namespace hashing {
+/// written in native byte order, reads back differently on other machines
+constexpr std::uint64_t ORDER_MARK = 0x0102030405060708ULL;
+
+/// splitmix64 finalizer
+[[nodiscard]] inline std::uint64_t mix(std::uint64_t value) {
+  value ^= value >> 30U;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27U;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31U;
+  return value;
+}
+
+/// checksum of the words of a record or chunk, including their number
+[[nodiscard]] inline std::uint64_t checksum(const std::uint64_t* words,
+                                            const std::size_t    count) {
+  std::uint64_t hash = mix(count + 0x9e3779b97f4a7c15ULL);
+  for (std::size_t w = 0U; w < count; w++) {
+    hash = mix(hash ^ words[w]);
+  }
+  return hash;
+}
+} // namespace hashing
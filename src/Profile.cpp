@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Profile.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+// trace event times are in microseconds
+double microseconds(const Profile::Clock::duration duration) {
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::nanoseconds>(duration)
+                 .count()) /
+         1e3;
+}
+} // namespace
+
+std::string toString(const ProfilePhase phase) {
+  switch (phase) {
+  case ProfilePhase::DagConstruction:
+    return "dagConstruction";
+  case ProfilePhase::Simulation:
+    return "simulation";
+  case ProfilePhase::Interning:
+    return "interning";
+  case ProfilePhase::ConstraintBuilding:
+    return "constraintBuilding";
+  case ProfilePhase::Solving:
+    return "solving";
+  }
+  return "unknown";
+}
+
+std::string toString(const ProfileCounter counter) {
+  switch (counter) {
+  case ProfileCounter::GatesApplied:
+    return "gatesApplied";
+  case ProfileCounter::InterningHits:
+    return "interningHits";
+  case ProfileCounter::InterningMisses:
+    return "interningMisses";
+  case ProfileCounter::BytesAllocated:
+    return "bytesAllocated";
+  }
+  return "unknown";
+}
+
+void Profile::addTime(const ProfilePhase phase, const Clock::time_point start,
+                      const Clock::time_point end) {
+  phases[static_cast<std::size_t>(phase)] += static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+          .count());
+  if (tracing) {
+    trace.push_back(
+        {phase, start, end - start,
+         static_cast<std::uint64_t>(
+             std::hash<std::thread::id>{}(std::this_thread::get_id()))});
+  }
+}
+
+json Profile::to_json() const {
+  json times = json::object();
+  for (std::size_t p = 0U; p < NR_OF_PROFILE_PHASES; p++) {
+    times[toString(static_cast<ProfilePhase>(p))] = phases[p];
+  }
+  json counts = json::object();
+  for (std::size_t c = 0U; c < NR_OF_PROFILE_COUNTERS; c++) {
+    counts[toString(static_cast<ProfileCounter>(c))] = counters[c];
+  }
+  return json{{"phaseNanoseconds", times}, {"counters", counts}};
+}
+
+void Profile::from_json(const json& j) {
+  const auto& times = j.at("phaseNanoseconds");
+  for (std::size_t p = 0U; p < NR_OF_PROFILE_PHASES; p++) {
+    phases[p] = times.value(toString(static_cast<ProfilePhase>(p)),
+                            std::uint64_t{0U});
+  }
+  const auto& counts = j.at("counters");
+  for (std::size_t c = 0U; c < NR_OF_PROFILE_COUNTERS; c++) {
+    counters[c] = counts.value(toString(static_cast<ProfileCounter>(c)),
+                               std::uint64_t{0U});
+  }
+}
+
+json Profile::toChromeTrace() const {
+  auto events = json::array();
+  // times are relative to the start of the earliest span, spans are recorded
+  // when they end
+  auto origin = trace.empty() ? Clock::time_point{} : trace.front().start;
+  for (const auto& span : trace) {
+    origin = std::min(origin, span.start);
+  }
+  auto last = origin;
+  for (const auto& span : trace) {
+    events.push_back({{"name", toString(span.phase)},
+                      {"cat", "qusat"},
+                      {"ph", "X"},
+                      {"ts", microseconds(span.start - origin)},
+                      {"dur", microseconds(span.duration)},
+                      {"pid", 0},
+                      {"tid", span.thread}});
+    last = std::max(last, span.start + span.duration);
+  }
+  for (std::size_t c = 0U; c < NR_OF_PROFILE_COUNTERS; c++) {
+    const auto name = toString(static_cast<ProfileCounter>(c));
+    events.push_back({{"name", name},
+                      {"cat", "qusat"},
+                      {"ph", "C"},
+                      {"ts", microseconds(last - origin)},
+                      {"pid", 0},
+                      {"args", {{name, counters[c]}}}});
+  }
+  return json{{"traceEvents", events}, {"displayTimeUnit", "ns"}};
+}
+
+void Profile::writeChromeTrace(const std::string& path) const {
+  std::ofstream file(path);
+  if (!file) {
+    throw std::runtime_error("Could not open trace file " + path);
+  }
+  file << toChromeTrace().dump();
+  if (!file) {
+    throw std::runtime_error("Could not write trace file " + path);
+  }
+}
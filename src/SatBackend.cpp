@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "SatBackend.hpp"
+
+#include "CancellationToken.hpp"
+#include "CdclSolver.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <z3++.h>
+
+namespace {
+// z3's solver on the clauses as propositional formulas over Boolean constants
+class Z3Backend final : public SatBackend {
+public:
+  void addClause(const Literal* first, const Literal* last) override {
+    z3::expr_vector clause(ctx);
+    for (const auto* it = first; it != last; ++it) {
+      clause.push_back(expression(*it));
+    }
+    solver.add(clause.empty() ? ctx.bool_val(false) : z3::mk_or(clause));
+  }
+
+  void assume(const Literal literal) override {
+    assumptions.push_back(expression(literal));
+  }
+
+  SatResult solve() override {
+    model.clear();
+    stopped = pollLimits();
+    if (stopped != Interruption::None) {
+      assumptions.resize(0U);
+      return SatResult::Unknown;
+    }
+    // z3's defaults for the limits that are not set
+    auto timeout = std::numeric_limits<unsigned>::max();
+    auto memory  = std::numeric_limits<unsigned>::max();
+    if (limits.deadline.has_value()) {
+      const auto remaining =
+          std::chrono::duration_cast<std::chrono::milliseconds>(
+              *limits.deadline - std::chrono::steady_clock::now())
+              .count();
+      // the deadline has not passed yet, at least 1 ms is left
+      timeout = static_cast<unsigned>(std::max<std::int64_t>(remaining, 1));
+    }
+    if (limits.memoryLimit > 0U) {
+      memory = static_cast<unsigned>(limits.memoryLimit);
+    }
+    z3::params params(ctx);
+    params.set("timeout", timeout);
+    params.set("max_memory", memory);
+    params.set("rlimit", static_cast<unsigned>(limits.resourceLimit));
+    solver.set(params);
+
+    // z3 cannot poll the token, so cancelling it interrupts the context
+    std::unique_ptr<CancellationToken::Subscription> subscription;
+    if (limits.cancellation.has_value()) {
+      subscription =
+          limits.cancellation->subscribe([this] { ctx.interrupt(); });
+    }
+    const auto result = solver.check(assumptions);
+    subscription.reset();
+    assumptions.resize(0U);
+    if (result == z3::check_result::sat) {
+      const auto m = solver.get_model();
+      model.reserve(vars.size());
+      for (const auto& var : vars) {
+        model.emplace_back(m.eval(var, true).is_true());
+      }
+      return SatResult::Satisfiable;
+    }
+    if (result == z3::check_result::unsat) {
+      return SatResult::Unsatisfiable;
+    }
+    stopped = pollLimits();
+    if (stopped == Interruption::None) {
+      stopped = interruptionFromReason(solver.reason_unknown());
+    }
+    return SatResult::Unknown;
+  }
+
+  [[nodiscard]] bool value(const Literal literal) const override {
+    const auto var = static_cast<std::size_t>(std::abs(literal)) - 1U;
+    const bool val = var < model.size() && model[var];
+    return literal > 0 ? val : !val;
+  }
+
+  [[nodiscard]] std::map<std::string, double> statistics() const override {
+    std::map<std::string, double> result{};
+    const auto                    stats = solver.statistics();
+    for (unsigned i = 0U; i < stats.size(); i++) {
+      result.emplace(stats.key(i),
+                     stats.is_double(i)
+                         ? stats.double_value(i)
+                         : static_cast<double>(stats.uint_value(i)));
+    }
+    return result;
+  }
+
+  [[nodiscard]] SatBackendType type() const override {
+    return SatBackendType::Z3;
+  }
+
+private:
+  static Interruption interruptionFromReason(const std::string& reason) {
+    if (reason.find("memory") != std::string::npos) {
+      return Interruption::MemoryLimit;
+    }
+    if (reason.find("timeout") != std::string::npos) {
+      return Interruption::Timeout;
+    }
+    if (reason.find("cancel") != std::string::npos ||
+        reason.find("interrupt") != std::string::npos) {
+      return Interruption::Cancelled;
+    }
+    return Interruption::ResourceLimit;
+  }
+
+  z3::expr expression(const Literal literal) {
+    const auto var = static_cast<std::size_t>(std::abs(literal)) - 1U;
+    while (vars.size() <= var) {
+      vars.emplace_back(
+          ctx.bool_const(("v" + std::to_string(vars.size() + 1U)).c_str()));
+    }
+    return literal > 0 ? vars[var] : !vars[var];
+  }
+
+  z3::context           ctx{};
+  z3::solver            solver{ctx};
+  std::vector<z3::expr> vars;
+  z3::expr_vector       assumptions{ctx};
+  std::vector<bool>     model;
+};
+} // namespace
+
+std::string toString(const Interruption interruption) {
+  switch (interruption) {
+  case Interruption::None:
+    return "none";
+  case Interruption::Timeout:
+    return "timeout";
+  case Interruption::MemoryLimit:
+    return "memory_limit";
+  case Interruption::ResourceLimit:
+    return "resource_limit";
+  case Interruption::Cancelled:
+    return "cancelled";
+  }
+  return "unknown";
+}
+
+Interruption interruptionFromString(const std::string& name) {
+  if (name == "none") {
+    return Interruption::None;
+  }
+  if (name == "timeout") {
+    return Interruption::Timeout;
+  }
+  if (name == "memory_limit") {
+    return Interruption::MemoryLimit;
+  }
+  if (name == "resource_limit") {
+    return Interruption::ResourceLimit;
+  }
+  if (name == "cancelled") {
+    return Interruption::Cancelled;
+  }
+  throw std::invalid_argument("Unknown interruption: " + name);
+}
+
+std::string toString(const SatBackendType type) {
+  switch (type) {
+  case SatBackendType::Z3:
+    return "z3";
+  case SatBackendType::CDCL:
+    return "cdcl";
+  }
+  return "unknown";
+}
+
+SatBackendType satBackendFromString(const std::string& name) {
+  if (name == "z3") {
+    return SatBackendType::Z3;
+  }
+  if (name == "cdcl") {
+    return SatBackendType::CDCL;
+  }
+  throw std::invalid_argument("Unknown SAT backend: " + name);
+}
+
+std::unique_ptr<SatBackend> SatBackend::create(const SatBackendType type) {
+  if (type == SatBackendType::CDCL) {
+    return std::make_unique<CdclSolver>();
+  }
+  return std::make_unique<Z3Backend>();
+}
@@ -10,13 +10,103 @@
 
 #include "SatEncoder.hpp"
 
+#include "BinaryStream.hpp"
+#include "CnfBuilder.hpp"
+#include "DimacsWriter.hpp"
+#include "GateSource.hpp"
+#include "GeneratorCache.hpp"
+#include "GeneratorEncoding.hpp"
+#include "Profile.hpp"
+#include "SatBackend.hpp"
+#include "StabilizerGroup.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <iostream>
+#include <istream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
 #include <vector>
-#include <z3++.h>
+
+namespace {
+constexpr std::size_t MEGABYTE = std::size_t{1} << 20U;
+
+// drops the clauses of an instance that is only counted
+class DiscardingSink : public CnfBuilder::Sink {
+public:
+  void addClause(const CnfBuilder::Literal* /*first*/,
+                 const CnfBuilder::Literal* /*last*/) override {}
+};
+
+// meaning of the variables of a level in the given encoding
+std::string levelSemantics(const std::string& encoding) {
+  if (encoding == toString(EncodingType::OneHot)) {
+    return "variable j of a level is true iff the level holds generator j";
+  }
+  if (encoding == toString(EncodingType::Order)) {
+    return "variable j of a level is true iff the level holds a generator id "
+           "greater than j";
+  }
+  return "the variables of a level are the bits of its generator id, least "
+         "significant first";
+}
+
+// levels of a circuit in memory, formed from its gates while they are pulled.
+// Levels as late as possible depend on all gates, so they are formed at once.
+class CircuitLevels {
+public:
+  CircuitLevels(const qc::QuantumComputation& circuit,
+                const LevelScheduling         levelScheduling,
+                const std::size_t             levelWindow)
+      : source(circuit), stream(source, levelWindow),
+        scheduling(levelScheduling) {}
+
+  bool next(std::vector<CliffordGate>& level) {
+    if (scheduling == LevelScheduling::AsSoonAsPossible) {
+      return stream.next(level);
+    }
+    if (!scheduled) {
+      std::vector<CliffordGate> gates;
+      while (const auto gate = source.next()) {
+        gates.push_back(*gate);
+      }
+      nrOfGates = gates.size();
+      scheduled = scheduleLevels(gates, source.qubits(), scheduling);
+    }
+    if (position == scheduled->size()) {
+      return false;
+    }
+    level = std::move((*scheduled)[position++]);
+    return true;
+  }
+
+  [[nodiscard]] std::size_t gates() const {
+    return scheduling == LevelScheduling::AsSoonAsPossible ? stream.gates()
+                                                           : nrOfGates;
+  }
+
+private:
+  CircuitGateSource                                     source;
+  LevelStream                                           stream;
+  LevelScheduling                                       scheduling;
+  std::optional<std::vector<std::vector<CliffordGate>>> scheduled;
+  std::size_t                                           position  = 0U;
+  std::size_t                                           nrOfGates = 0U;
+};
+} // namespace
 
 bool SatEncoder::testEqual(qc::QuantumComputation&         circuit,
                            qc::QuantumComputation&         circuitTwo,
@@ -29,18 +119,110 @@ bool SatEncoder::testEqual(qc::QuantumComputation&         circuit,
     std::cerr << "Both circuits must be non-empty" << std::endl;
     return false;
   }
+  armLimits();
   stats.nrOfDiffInputStates = inputs.size();
   stats.nrOfQubits          = circuit.getNqubits();
-  const auto dagOne         = qc::CircuitOptimizer::constructDAG(circuit);
-  const auto dagTwo         = qc::CircuitOptimizer::constructDAG(circuitTwo);
-  const CircuitRepresentation circOneRep = preprocessCircuit(dagOne, inputs);
-  const CircuitRepresentation circTwoRep = preprocessCircuit(dagTwo, inputs);
-  z3::context                 ctx{};
-  z3::solver                  solver(ctx);
-  constructMiterInstance(circOneRep, circTwoRep, solver);
+  // both circuits are simulated together, sharing the pool and the generators
+  const auto unitary =
+      configuration.equivalenceCheck == EquivalenceCheck::Unitary;
+  try {
+    return decideEquivalence(
+        preprocessCircuits({&circuit, &circuitTwo}, inputs, unitary), inputs);
+  } catch (const Interrupted& e) {
+    return giveUp(e.reason);
+  }
+}
+
+bool SatEncoder::testEqual(GateSource& circuit, GateSource& circuitTwo,
+                           const std::vector<std::string>& inputs) {
+  if (circuit.qubits() != circuitTwo.qubits()) {
+    std::cerr << "Both circuits must act on the same number of qubits"
+              << std::endl;
+    return false;
+  }
+  armLimits();
+  stats.nrOfDiffInputStates = inputs.size();
+  stats.nrOfQubits          = circuit.qubits();
+  LevelStream                one(circuit, configuration.streamWindow);
+  LevelStream                two(circuitTwo, configuration.streamWindow);
+  std::vector<LevelSupplier> suppliers{
+      [&](std::vector<LevelGate>& level) { return one.next(level); },
+      [&](std::vector<LevelGate>& level) { return two.next(level); }};
+  const auto unitary =
+      configuration.equivalenceCheck == EquivalenceCheck::Unitary;
+  try {
+    const auto representations = preprocessLevels(
+        suppliers, {circuit.qubits(), circuitTwo.qubits()}, inputs, unitary);
+    stats.nrOfGates += one.gates() + two.gates();
+    // a source only tells that it is empty once it has been read
+    if (one.gates() == 0U || two.gates() == 0U) {
+      std::cerr << "Both circuits must be non-empty" << std::endl;
+      return false;
+    }
+    return decideEquivalence(representations, inputs);
+  } catch (const Interrupted& e) {
+    stats.nrOfGates += one.gates() + two.gates();
+    return giveUp(e.reason);
+  }
+}
 
-  const bool equal = !isSatisfiable(solver);
-  stats.equal      = equal;
+bool SatEncoder::decideEquivalence(
+    const std::vector<CircuitRepresentation>& representations,
+    const std::vector<std::string>&           inputs) {
+  const auto unitary =
+      configuration.equivalenceCheck == EquivalenceCheck::Unitary;
+  stats.equivalenceCheck = toString(configuration.equivalenceCheck);
+  if (configuration.equivalenceCheck == EquivalenceCheck::Direct) {
+    const auto differing =
+        firstDifferingOutput(representations[0], representations[1]);
+    if (differing.has_value()) {
+      recordCounterexample(representations[0], representations[1], inputs,
+                           *differing);
+    }
+    stats.equal = !differing.has_value();
+    return stats.equal;
+  }
+  if (unitary) {
+    // equal tableaus are interned once, so the circuits are equal up to global
+    // phase iff they map the identity to the same generator
+    stats.equal = representations[0].outputGenerators ==
+                  representations[1].outputGenerators;
+    if (!configuration.crossCheck) {
+      return stats.equal;
+    }
+  }
+
+  CnfBuilder cnf{};
+  const auto selectors =
+      constructMiterInstance(representations[0], representations[1], cnf);
+
+  // the input generator of a model distinguishes both circuits
+  std::optional<std::size_t> inputId;
+  const bool equal = !isSatisfiable(cnf, [&](const SatBackend& solver) {
+    for (std::size_t id = 0U; id < selectors.size() && !inputId; id++) {
+      if (std::all_of(selectors[id].begin(), selectors[id].end(),
+                      [&](const auto lit) { return solver.value(lit); })) {
+        inputId = id;
+      }
+    }
+  });
+  if (!unitary && inputId.has_value()) {
+    const auto& ids   = representations[0].inputGenerators;
+    const auto  input = std::find(ids.begin(), ids.end(), *inputId);
+    if (input != ids.end()) {
+      recordCounterexample(representations[0], representations[1], inputs,
+                           static_cast<std::size_t>(input - ids.begin()));
+    }
+  }
+  if (!stats.decided()) { // the solver gave up, there is no verdict
+    stats.equal = false;
+    return false;
+  }
+  if (unitary && equal != stats.equal) {
+    throw std::logic_error(
+        "The SAT miter disagrees with the comparison of the tableaus");
+  }
+  stats.equal = equal;
 
   return equal;
 }
@@ -60,509 +242,1044 @@ bool SatEncoder::checkSatisfiability(qc::QuantumComputation&         circuitOne,
     std::cerr << "Circuit is not Clifford Circuit." << std::endl;
     return false;
   }
+  armLimits();
   stats.nrOfDiffInputStates = inputs.size();
   stats.nrOfQubits          = circuitOne.getNqubits();
-  const auto  dag           = qc::CircuitOptimizer::constructDAG(circuitOne);
-  const auto  circRep       = preprocessCircuit(dag, inputs);
-  z3::context ctx{};
-  z3::solver  solver(ctx);
-  constructSatInstance(circRep, solver);
+  try {
+    const auto circRep = preprocessCircuit(circuitOne, inputs);
+    CnfBuilder cnf{};
+    constructSatInstance(circRep, cnf);
 
-  stats.satisfiable = this->isSatisfiable(solver);
-  return stats.satisfiable;
+    stats.satisfiable = this->isSatisfiable(cnf);
+    return stats.satisfiable;
+  } catch (const Interrupted& e) {
+    return giveUp(e.reason);
+  }
+}
+
+bool SatEncoder::checkSatisfiability(GateSource&                     circuit,
+                                     const std::vector<std::string>& inputs) {
+  armLimits();
+  stats.nrOfDiffInputStates = inputs.size();
+  stats.nrOfQubits          = circuit.qubits();
+  LevelStream                stream(circuit, configuration.streamWindow);
+  std::vector<LevelSupplier> suppliers{
+      [&](std::vector<LevelGate>& level) { return stream.next(level); }};
+  try {
+    const auto circRep =
+        preprocessLevels(suppliers, {circuit.qubits()}, inputs, false).front();
+    stats.nrOfGates += stream.gates();
+    CnfBuilder cnf{};
+    constructSatInstance(circRep, cnf);
+
+    stats.satisfiable = this->isSatisfiable(cnf);
+    return stats.satisfiable;
+  } catch (const Interrupted& e) {
+    stats.nrOfGates += stream.gates();
+    return giveUp(e.reason);
+  }
 }
 
 std::string SatEncoder::generateDIMACS(qc::QuantumComputation& qc) {
-  const auto                  dag  = qc::CircuitOptimizer::constructDAG(qc);
-  const CircuitRepresentation circ = preprocessCircuit(dag, {});
+  armLimits();
+  const CircuitRepresentation circ = preprocessCircuit(qc, {});
+
+  CnfBuilder cnf{};
+  constructSatInstance(circ, cnf);
+  return cnf.toDIMACS();
+}
+
+std::string SatEncoder::generateDIMACS(GateSource& circuit) {
+  armLimits();
+  LevelStream                stream(circuit, configuration.streamWindow);
+  std::vector<LevelSupplier> suppliers{
+      [&](std::vector<LevelGate>& level) { return stream.next(level); }};
+  const auto circ =
+      preprocessLevels(suppliers, {circuit.qubits()}, {}, false).front();
+
+  CnfBuilder cnf{};
+  constructSatInstance(circ, cnf);
+  return cnf.toDIMACS();
+}
+
+void SatEncoder::writeDIMACS(qc::QuantumComputation& qc,
+                             DimacsWriter&           writer) {
+  armLimits();
+  writeDIMACS(preprocessCircuit(qc, {}), writer);
+}
+
+void SatEncoder::writeDIMACS(GateSource& circuit, DimacsWriter& writer) {
+  armLimits();
+  LevelStream                stream(circuit, configuration.streamWindow);
+  std::vector<LevelSupplier> suppliers{
+      [&](std::vector<LevelGate>& level) { return stream.next(level); }};
+  writeDIMACS(
+      preprocessLevels(suppliers, {circuit.qubits()}, {}, false).front(),
+      writer);
+}
+
+void SatEncoder::writeDIMACS(const CircuitRepresentation& representation,
+                             DimacsWriter&                writer) {
+  // the first pass only counts the clauses for the problem line, its
+  // statistics are replaced by the ones of the second pass
+  DiscardingSink discard;
+  CnfBuilder     counter{};
+  counter.setSink(&discard);
+  const auto before   = stats;
+  const auto levels   = constructSatInstance(representation, counter);
+  const auto encoding = stats.encoding;
+  stats               = before;
+
+  writer.comment("qusat instance of a Clifford circuit, encoding " + encoding +
+                 ", " + std::to_string(generators.size()) + " generators, " +
+                 std::to_string(levels.size()) + " levels");
+  writer.comment(levelSemantics(encoding));
+  for (std::size_t k = 0U; k < levels.size(); k++) {
+    std::string line = "level " + std::to_string(k) + ":";
+    for (const auto var : levels[k]) {
+      line += " " + std::to_string(var);
+    }
+    writer.comment(line);
+  }
+  for (std::size_t i = 0U; i < representation.inputGenerators.size(); i++) {
+    writer.comment("input " + std::to_string(i) + ": generator " +
+                   std::to_string(representation.inputGenerators[i]) +
+                   " -> generator " +
+                   std::to_string(representation.outputGenerators[i]));
+  }
+  writer.problem(counter.variables(), counter.clauses());
+
+  CnfBuilder cnf{};
+  cnf.setSink(&writer);
+  constructSatInstance(representation, cnf);
+  writer.finish();
+}
+
+void SatEncoder::preprocess(qc::QuantumComputation&         circuit,
+                            const std::vector<std::string>& inputs,
+                            std::ostream&                   os) {
+  if (!isClifford(circuit)) {
+    throw std::invalid_argument("Circuit is not a Clifford circuit");
+  }
+  armLimits();
+  stats.nrOfDiffInputStates = inputs.size();
+  stats.nrOfQubits          = circuit.getNqubits();
+  writeRepresentations(preprocessCircuits({&circuit}, inputs, false), inputs,
+                       false, os);
+}
+
+void SatEncoder::preprocess(qc::QuantumComputation&         circuit,
+                            qc::QuantumComputation&         circuitTwo,
+                            const std::vector<std::string>& inputs,
+                            std::ostream&                   os) {
+  if (!isClifford(circuit) || !isClifford(circuitTwo)) {
+    throw std::invalid_argument("Circuits are not Clifford circuits");
+  }
+  armLimits();
+  stats.nrOfDiffInputStates = inputs.size();
+  stats.nrOfQubits          = circuit.getNqubits();
+  const auto unitary =
+      configuration.equivalenceCheck == EquivalenceCheck::Unitary;
+  writeRepresentations(
+      preprocessCircuits({&circuit, &circuitTwo}, inputs, unitary), inputs,
+      unitary, os);
+}
+
+bool SatEncoder::testEqual(std::istream& preprocessed) {
+  armLimits();
+  const auto unitary =
+      configuration.equivalenceCheck == EquivalenceCheck::Unitary;
+  std::vector<std::string> inputs;
+  const auto               representations =
+      readRepresentations(preprocessed, 2U, unitary, inputs);
+  return decideEquivalence(representations, inputs);
+}
+
+bool SatEncoder::checkSatisfiability(std::istream& preprocessed) {
+  armLimits();
+  std::vector<std::string> inputs;
+  const auto               circRep =
+      readRepresentations(preprocessed, 1U, false, inputs).front();
+  CnfBuilder cnf{};
+  constructSatInstance(circRep, cnf);
+
+  stats.satisfiable = this->isSatisfiable(cnf);
+  return stats.satisfiable;
+}
 
-  z3::context ctx{};
-  z3::goal    g(ctx);
-  z3::solver  solver(ctx);
-  constructSatInstance(circ, solver);
+void SatEncoder::writeSatInstance(qc::QuantumComputation& qc,
+                                  std::ostream&           os) {
+  armLimits();
+  const CircuitRepresentation circ = preprocessCircuit(qc, {});
 
-  for (const auto& cons : solver.assertions())
-    g.add(cons);
+  CnfBuilder cnf{};
+  constructSatInstance(circ, cnf);
+  cnf.writeBinary(os);
+}
 
-  z3::tactic bit_blast_tactic(ctx, "bit-blast");
-  z3::tactic tseitin_cnf_tactic(ctx, "tseitin-cnf");
-  z3::tactic combined_tactic = bit_blast_tactic & tseitin_cnf_tactic;
+void SatEncoder::writeRepresentations(
+    const std::vector<CircuitRepresentation>& representations,
+    const std::vector<std::string>& inputs, const bool unitary,
+    std::ostream& os) const {
+  BinaryWriter writer(os, BinaryKind::Circuits);
+  writer.write(representations.size());
+  writer.write(unitary ? 1U : 0U);
+  writer.write(stats.nrOfQubits);
+  writer.write(stats.nrOfGates);
+  writer.write(stats.circuitDepth);
+  writer.write(inputs.size());
+  for (const auto& input : inputs) {
+    writer.write(input);
+  }
 
-  z3::apply_result r = combined_tactic(g);
+  // the arena of the generators in the order of their ids
+  writer.write(nrOfInputGenerators);
+  writer.write(generators.size());
+  for (std::size_t id = 0U; id < generators.size(); id++) {
+    writer.write(generators.qubits(id));
+    writer.write(generators.rows(id));
+    writer.write(generators.wordCount(id));
+    writer.write(generators.words(id), generators.wordCount(id));
+  }
 
-  return r[0].dimacs(false);
+  for (const auto& representation : representations) {
+    for (const auto* ids : {&representation.inputGenerators,
+                            &representation.outputGenerators}) {
+      writer.write(ids->size());
+      for (const auto id : *ids) {
+        writer.write(id);
+      }
+    }
+    writer.write(representation.levels);
+    writer.write(representation.generatorMappings.size());
+    for (std::size_t k = 0U; k < representation.generatorMappings.size();
+         k++) {
+      const auto& layer = representation.generatorMappings[k];
+      writer.write(representation.levelIndex[k]);
+      writer.write(layer.size());
+      for (const auto& [from, to] : layer) {
+        writer.write(from);
+        writer.write(to);
+      }
+    }
+  }
+  writer.finish();
 }
 
-bool SatEncoder::isSatisfiable(z3::solver& solver) {
+std::vector<SatEncoder::CircuitRepresentation>
+SatEncoder::readRepresentations(std::istream&             is,
+                                const std::size_t         nrOfCircuits,
+                                const bool                unitary,
+                                std::vector<std::string>& inputs) {
+  BinaryReader reader(is, BinaryKind::Circuits);
+  if (reader.read() != nrOfCircuits) {
+    throw std::invalid_argument("Expected " + std::to_string(nrOfCircuits) +
+                                " preprocessed circuits");
+  }
+  if ((reader.read() != 0U) != unitary) {
+    throw std::invalid_argument(
+        "Circuits were preprocessed for another kind of check");
+  }
+  stats.nrOfQubits   = reader.read();
+  stats.nrOfGates    = reader.read();
+  stats.circuitDepth = reader.read();
+  inputs.clear();
+  for (auto count = reader.read(); count > 0U; count--) {
+    inputs.emplace_back(reader.readString());
+  }
+  stats.nrOfDiffInputStates = inputs.size();
+
+  // the generators are interned in the order of their ids, which therefore
+  // stay the same
+  generators.clear();
+  nrOfInputGenerators = reader.read();
+  std::vector<std::uint64_t> words;
+  for (auto id = std::uint64_t{0U}, count = reader.read(); id < count; id++) {
+    const auto qubits = reader.read();
+    const auto rows   = reader.read();
+    const auto size   = reader.read();
+    if ((rows != qubits && rows != 2U * qubits) ||
+        size != ((2U * qubits) + 1U) *
+                    ((rows + Tableau::WORD_BITS - 1U) / Tableau::WORD_BITS)) {
+      throw std::runtime_error("Preprocessed generator has an invalid size");
+    }
+    words.clear();
+    for (std::uint64_t w = 0U; w < size; w++) {
+      words.push_back(reader.read());
+    }
+    if (generators.intern(Tableau::fromWords(words.data(), qubits, rows))
+            .first != id) {
+      throw std::runtime_error("Preprocessed generators are not distinct");
+    }
+  }
+  if (nrOfInputGenerators > generators.size()) {
+    throw std::runtime_error("Preprocessed circuits have too many inputs");
+  }
+
+  const auto readId = [&]() {
+    const auto id = reader.read();
+    if (id >= generators.size()) {
+      throw std::runtime_error("Preprocessed circuit has an unknown generator");
+    }
+    return static_cast<std::size_t>(id);
+  };
+  std::vector<CircuitRepresentation> representations(nrOfCircuits);
+  for (auto& representation : representations) {
+    for (auto* ids : {&representation.inputGenerators,
+                      &representation.outputGenerators}) {
+      for (auto count = reader.read(); count > 0U; count--) {
+        ids->push_back(readId());
+      }
+    }
+    representation.levels = reader.read();
+    // the mappings have to lead every input generator to its output
+    // generator, and are compressed further as this encoder is configured
+    auto ids = representation.inputGenerators;
+    for (auto depth = reader.read(); depth > 0U; depth--) {
+      const auto level = reader.read();
+      if (level >= representation.levels ||
+          (!representation.levelIndex.empty() &&
+           level <= representation.levelIndex.back())) {
+        throw std::runtime_error("Preprocessed circuit has an invalid level");
+      }
+      std::map<std::size_t, std::size_t> layer;
+      for (auto size = reader.read(); size > 0U; size--) {
+        const auto from = readId();
+        layer.emplace(from, readId());
+      }
+      for (auto& id : ids) {
+        const auto it = layer.find(id);
+        if (it == layer.end()) {
+          throw std::runtime_error("Preprocessed circuit misses a mapping");
+        }
+        id = it->second;
+      }
+      appendLevel(representation, std::move(layer),
+                  static_cast<std::size_t>(level),
+                  configuration.levelCompression);
+    }
+    if (ids != representation.outputGenerators) {
+      throw std::runtime_error(
+          "Preprocessed circuit does not lead to its outputs");
+    }
+  }
+  if (!reader.atEnd()) {
+    throw std::runtime_error("Preprocessed circuits are followed by more data");
+  }
+  return representations;
+}
+
+void SatEncoder::armLimits() {
+  stats.interruption = Interruption::None;
+  deadline.reset();
+  if (configuration.timeout > 0U) {
+    deadline = std::chrono::steady_clock::now() +
+               std::chrono::milliseconds(configuration.timeout);
+  }
+}
+
+Interruption SatEncoder::pollLimits() const {
+  if (cancellation.has_value() && cancellation->cancelled()) {
+    return Interruption::Cancelled;
+  }
+  if (deadline.has_value() && std::chrono::steady_clock::now() >= *deadline) {
+    return Interruption::Timeout;
+  }
+  // the generators dominate the memory of the simulation
+  if (configuration.memoryLimit > 0U &&
+      generators.bytes() >= configuration.memoryLimit * MEGABYTE) {
+    return Interruption::MemoryLimit;
+  }
+  return Interruption::None;
+}
+
+bool SatEncoder::giveUp(const Interruption reason) {
+  stats.interruption = reason;
+  stats.equal        = false;
+  stats.satisfiable  = false;
+  return false;
+}
+
+SolverLimits SatEncoder::solverLimits() const {
+  SolverLimits limits{};
+  limits.deadline      = deadline;
+  limits.memoryLimit   = configuration.memoryLimit;
+  limits.resourceLimit = configuration.resourceLimit;
+  limits.cancellation  = cancellation;
+  return limits;
+}
+
+bool SatEncoder::isSatisfiable(
+    const CnfBuilder&                              cnf,
+    const std::function<void(const SatBackend&)>& onModel) {
   stats.satisfiable = false;
   auto before       = std::chrono::high_resolution_clock::now();
-  auto sat          = solver.check();
-  auto after        = std::chrono::high_resolution_clock::now();
-  auto z3SolvingDuration =
+
+  const auto backend = SatBackend::create(configuration.backend);
+  auto       sat     = SatResult::Unknown;
+  {
+    QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::Solving);
+    backend->addCnf(cnf);
+    backend->setLimits(solverLimits());
+    sat = backend->solve();
+  }
+  stats.interruption = sat == SatResult::Unknown ? backend->interruption()
+                                                 : Interruption::None;
+
+  auto after = std::chrono::high_resolution_clock::now();
+  auto solvingDuration =
       std::chrono::duration_cast<std::chrono::milliseconds>(after - before)
           .count();
-  stats.solvingTime = static_cast<std::size_t>(z3SolvingDuration);
+  stats.solvingTime = static_cast<std::size_t>(solvingDuration);
 
-  if (sat == z3::check_result::sat) {
+  if (sat == SatResult::Satisfiable) {
     stats.satisfiable = true;
+    if (onModel) {
+      onModel(*backend);
+    }
   }
 
-  for (size_t i = 0; i < solver.statistics().size(); i++) {
-    auto   key = solver.statistics().key(static_cast<unsigned>(i));
-    double val;
-    if (solver.statistics().is_double(static_cast<unsigned>(i))) {
-      val = solver.statistics().double_value(static_cast<unsigned>(i));
-    } else {
-      val = solver.statistics().uint_value(static_cast<unsigned>(i));
-    }
-    stats.z3StatsMap.emplace(key, val);
+  stats.satBackend = toString(backend->type());
+  for (const auto& [key, val] : backend->statistics()) {
+    stats.solverStatsMap.emplace(key, val);
   }
   return stats.satisfiable;
 }
 
+std::optional<std::size_t>
+SatEncoder::firstDifferingOutput(const CircuitRepresentation& circOneRep,
+                                 const CircuitRepresentation& circTwoRep) {
+  auto before = std::chrono::high_resolution_clock::now();
+  QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::Solving);
+  // canonical groups of the output generators compared so far
+  std::unordered_map<std::size_t, StabilizerGroup> canonical;
+  const auto group = [&](const std::size_t id) -> const StabilizerGroup& {
+    auto it = canonical.find(id);
+    if (it == canonical.end()) {
+      it = canonical
+               .emplace(id, StabilizerGroup(generators.words(id),
+                                            generators.qubits(id),
+                                            generators.rows(id)))
+               .first;
+    }
+    return it->second;
+  };
+
+  std::optional<std::size_t> differing;
+  for (std::size_t i = 0U; i < circOneRep.outputGenerators.size(); i++) {
+    const auto idOne = circOneRep.outputGenerators[i];
+    const auto idTwo = circTwoRep.outputGenerators[i];
+    // equal tableaus are interned once, so only differing ids need the
+    // canonical form
+    if (idOne != idTwo && group(idOne) != group(idTwo)) {
+      differing = i;
+      break;
+    }
+  }
+
+  auto after        = std::chrono::high_resolution_clock::now();
+  stats.solvingTime = static_cast<std::size_t>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(after - before)
+          .count());
+  return differing;
+}
+
+void SatEncoder::recordCounterexample(const CircuitRepresentation& circOneRep,
+                                      const CircuitRepresentation& circTwoRep,
+                                      const std::vector<std::string>& inputs,
+                                      const std::size_t               input) {
+  stats.counterexample.found = true;
+  stats.counterexample.input = input;
+  stats.counterexample.state =
+      inputs.empty() ? std::string(stats.nrOfQubits, 'I') : inputs.at(input);
+
+  // follow the generators of the input through both circuits level by level
+  // until they differ. Levels without a mapping of their own keep the
+  // generator, and so does the shorter circuit after its last level.
+  auto        idOne = circOneRep.inputGenerators.at(input);
+  auto        idTwo = circTwoRep.inputGenerators.at(input);
+  std::size_t one   = 0U;
+  std::size_t two   = 0U;
+  stats.counterexample.level = std::max(circOneRep.levels, circTwoRep.levels);
+  while (one < circOneRep.levelIndex.size() ||
+         two < circTwoRep.levelIndex.size()) {
+    const auto level =
+        std::min(one < circOneRep.levelIndex.size()
+                     ? circOneRep.levelIndex[one]
+                     : std::numeric_limits<std::size_t>::max(),
+                 two < circTwoRep.levelIndex.size()
+                     ? circTwoRep.levelIndex[two]
+                     : std::numeric_limits<std::size_t>::max());
+    if (one < circOneRep.levelIndex.size() &&
+        circOneRep.levelIndex[one] == level) {
+      idOne = circOneRep.generatorMappings[one++].at(idOne);
+    }
+    if (two < circTwoRep.levelIndex.size() &&
+        circTwoRep.levelIndex[two] == level) {
+      idTwo = circTwoRep.generatorMappings[two++].at(idTwo);
+    }
+    if (idOne != idTwo) {
+      stats.counterexample.level = level;
+      break;
+    }
+  }
+}
+
 SatEncoder::CircuitRepresentation
-SatEncoder::preprocessCircuit(const qc::CircuitOptimizer::DAG& dag,
-                              const std::vector<std::string>&  inputs) {
-  const auto            before     = std::chrono::high_resolution_clock::now();
-  const std::size_t     inputSize  = dag.size();
-  std::size_t           nrOfLevels = 0;
-  std::size_t           nrOfOpsOnQubit = 0;
-  std::vector<QState>   states;
-  CircuitRepresentation representation;
-  const auto            nrOfQubits = dag.size();
-
-  // compute nr of levels of ckt = #generators needed per input state
-  for (std::size_t i = 0U; i < inputSize; i++) {
-    if (const auto tmp = dag.at(i).size(); tmp > nrOfLevels) {
-      nrOfLevels = tmp;
-    }
-  }
-
-  stats.circuitDepth =
-      nrOfLevels > stats.circuitDepth ? nrOfLevels : stats.circuitDepth;
-  representation.generatorMappings =
-      std::vector<std::map<std::size_t, std::size_t>>(nrOfLevels);
-
-  if (!inputs.empty()) {
-    for (auto& input : inputs) {
-      states.push_back(initializeState(nrOfQubits, input));
-    }
-  } else {
-    states.push_back(initializeState(nrOfQubits, {}));
-  }
-
-  // store generators of input state
-  for (auto& state : states) {
-    auto        initLevelGenerator = state.getLevelGenerator();
-    auto        inspair = generators.emplace(initLevelGenerator, uniqueGenCnt);
-    std::size_t id;
-    if (inspair.second) {
-      id = uniqueGenCnt++;
+SatEncoder::preprocessCircuit(const qc::QuantumComputation&   circuit,
+                              const std::vector<std::string>& inputs) {
+  return preprocessCircuits({&circuit}, inputs, false).front();
+}
+
+std::vector<SatEncoder::CircuitRepresentation> SatEncoder::preprocessCircuits(
+    const std::vector<const qc::QuantumComputation*>& circuits,
+    const std::vector<std::string>& inputs, const bool unitary) {
+  std::deque<CircuitLevels>  levels;
+  std::vector<LevelSupplier> suppliers;
+  std::vector<std::size_t>   qubits;
+  for (const auto* circuit : circuits) {
+    auto& circuitLevels =
+        levels.emplace_back(*circuit, configuration.levelScheduling,
+                            configuration.streamWindow);
+    qubits.emplace_back(circuit->getNqubits());
+    suppliers.emplace_back([&circuitLevels](std::vector<LevelGate>& level) {
+      return circuitLevels.next(level);
+    });
+  }
+  const auto countGates = [&]() {
+    for (const auto& circuitLevels : levels) {
+      stats.nrOfGates += circuitLevels.gates();
+    }
+  };
+  try {
+    auto representations = preprocessLevels(suppliers, qubits, inputs, unitary);
+    countGates();
+    return representations;
+  } catch (const Interrupted&) {
+    countGates();
+    throw;
+  }
+}
+
+std::vector<SatEncoder::CircuitRepresentation>
+SatEncoder::preprocessLevels(std::vector<LevelSupplier>&     circuits,
+                             const std::vector<std::size_t>& qubits,
+                             const std::vector<std::string>& inputs,
+                             const bool                      unitary) {
+  const auto before       = std::chrono::high_resolution_clock::now();
+  const auto nrOfCircuits = circuits.size();
+  [[maybe_unused]] const auto bytesBefore = generators.bytes();
+  std::vector<std::vector<QState>>   states(nrOfCircuits);
+  std::vector<CircuitRepresentation> representations(nrOfCircuits);
+
+  for (std::size_t c = 0U; c < nrOfCircuits; c++) {
+    const auto nrOfQubits = qubits[c];
+    if (unitary) {
+      states[c].push_back(QState{Tableau::identity(nrOfQubits)});
+    } else if (!inputs.empty()) {
+      QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::Simulation);
+      states[c].resize(inputs.size());
+      forEachState(states[c].size(), [&](const std::size_t i) {
+        states[c][i] = initializeState(nrOfQubits, inputs[i]);
+      });
     } else {
-      id = generators.at(initLevelGenerator);
-    }
-    representation.idGeneratorMap.emplace(id, initLevelGenerator);
-    state.prevGenId = id;
-  }
-
-  if (nrOfInputGenerators == 0) { // only in first pass
-    nrOfInputGenerators = uniqueGenCnt;
-  }
-
-  for (std::size_t levelCnt = 0; levelCnt < nrOfLevels; levelCnt++) {
-    for (std::size_t qubitCnt = 0U; qubitCnt < inputSize;
-         qubitCnt++) { // operation of current level for each qubit
-      nrOfOpsOnQubit = dag.at(qubitCnt).size();
-
-      if (levelCnt < nrOfOpsOnQubit) {
-        if (!dag.at(qubitCnt).empty() &&
-            dag.at(qubitCnt).at(levelCnt) != nullptr) {
-          stats.nrOfGates++;
-          const auto gate = dag.at(qubitCnt).at(levelCnt)->get();
-          const auto target =
-              gate->getTargets().at(0U); // we assume we only have 1 target
-
-          for (auto& currState : states) {
-            if (gate->getType() == qc::OpType::H) {
-              currState.applyH(target);
-            } else if (gate->getType() == qc::OpType::S) {
-              currState.applyS(target);
-            } else if (gate->getType() == qc::OpType::Sdg) {
-              currState.applyS(target); // Sdag == SSS
-              currState.applyS(target);
-              currState.applyS(target);
-            } else if (gate->getType() == qc::OpType::Z) {
-              currState.applyH(target);
-              currState.applyS(target);
-              currState.applyS(target);
-              currState.applyH(target);
-            } else if (gate->getType() == qc::OpType::X &&
-                       !gate->isControlled()) {
-              currState.applyH(target);
-              currState.applyS(target);
-              currState.applyS(target);
-            } else if (gate->getType() == qc::OpType::Y) {
-              currState.applyH(target);
-              currState.applyS(target);
-              currState.applyS(target);
-              currState.applyS(target);
-            } else if (gate->isControlled() &&
-                       gate->getType() == qc::OpType::X) { // CNOT
-              const auto control =
-                  gate->getControls()
-                      .begin()
-                      ->qubit; // we assume we only have 1 control
-              if (qubitCnt ==
-                  control) { // CNOT is for control and target in DAG, only
-                             // apply if current qubit is control
-                currState.applyCNOT(control, target);
-              }
-            }
-          }
+      states[c].push_back(initializeState(nrOfQubits, {}));
+    }
+
+    // store generators of input state
+    QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::Interning);
+    for (auto& state : states[c]) {
+      const auto [id, added] = generators.intern(state.tableau);
+      QUSAT_PROFILE_COUNT(stats.profile,
+                          added ? ProfileCounter::InterningMisses
+                                : ProfileCounter::InterningHits,
+                          1U);
+      state.prevGenId = id;
+      representations[c].inputGenerators.emplace_back(state.prevGenId);
+    }
+
+    if (nrOfInputGenerators == 0) { // only in first pass
+      nrOfInputGenerators = generators.size();
+    }
+  }
+
+  // levels that the cache holds for the same inputs are replayed from it. The
+  // tableaus of a circuit are then stale and only restored from its current
+  // generators once it has to be simulated again.
+  if (!configuration.cacheFile.empty() && !cache) {
+    cache = std::make_unique<GeneratorCache>(configuration.cacheFile);
+  }
+  const bool caching = cache != nullptr && cache->usable();
+  std::vector<GeneratorCache::Key>                 inputKeys(nrOfCircuits);
+  std::vector<GeneratorCache::Key>                 prefixKeys(nrOfCircuits);
+  std::vector<std::vector<GeneratorCache::Key>>    levelKeys(nrOfCircuits);
+  std::vector<std::vector<GeneratorCache::Record>> records(nrOfCircuits);
+  std::vector<std::vector<std::vector<std::size_t>>> chains(nrOfCircuits);
+  std::vector<bool>                                stale(nrOfCircuits, false);
+  std::vector<bool> simulated(nrOfCircuits, false);
+  if (caching) {
+    for (std::size_t c = 0U; c < nrOfCircuits; c++) {
+      std::vector<const Tableau*> tableaus;
+      for (const auto& state : states[c]) {
+        tableaus.push_back(&state.tableau);
+      }
+      inputKeys[c]  = GeneratorCache::inputKey(tableaus);
+      prefixKeys[c] = inputKeys[c];
+      records[c]    = cache->find(inputKeys[c], tableaus);
+      for (const auto id : representations[c].inputGenerators) {
+        chains[c].emplace_back(1U, id);
+      }
+    }
+  }
+
+  // circuits that start with the same levels as the first circuit, e.g., a
+  // circuit before and after optimization, reuse its states and mappings for
+  // these levels instead of simulating them again
+  std::vector<bool> sharing(nrOfCircuits, false);
+  for (std::size_t c = 1U; c < nrOfCircuits; c++) {
+    sharing[c] = configuration.shareCommonPrefix && qubits[c] == qubits[0];
+  }
+
+  // all circuits advance in lockstep, one level at a time
+  std::vector<std::vector<LevelGate>>              levels(nrOfCircuits);
+  std::vector<std::map<std::size_t, std::size_t>>  layers(nrOfCircuits);
+  std::vector<bool>                                active(nrOfCircuits, true);
+  std::vector<std::pair<std::size_t, std::size_t>> work; // (circuit, state)
+  std::vector<std::optional<std::size_t>>          known;
+  for (std::size_t levelCnt = 0U;; levelCnt++) {
+    if (const auto reason = pollLimits(); reason != Interruption::None) {
+      throw Interrupted(reason);
+    }
+    {
+      // the streaming front end forms the levels while they are pulled
+      QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::DagConstruction);
+      for (std::size_t c = 0U; c < nrOfCircuits; c++) {
+        active[c] = active[c] && circuits[c](levels[c]);
+      }
+    }
+    if (std::none_of(active.begin(), active.end(),
+                     [](const bool a) { return a; })) {
+      break;
+    }
+
+    work.clear();
+    for (std::size_t c = 0U; c < nrOfCircuits; c++) {
+      if (sharing[c] &&
+          !(active[c] && active.front() && levels[c] == levels.front())) {
+        sharing[c] = false;
+        if (active[c]) {
+          states[c] = states.front(); // circuits diverge from here on
+          stale[c]  = stale.front();
         }
       }
+      if (!active[c]) {
+        continue;
+      }
+      // nr of levels of ckt = #generators needed per input state
+      layers[c].clear();
+      representations[c].levels = levelCnt + 1U;
+      stats.circuitDepth = std::max(stats.circuitDepth, levelCnt + 1U);
+      if (caching) {
+        prefixKeys[c] = GeneratorCache::levelKey(prefixKeys[c], levels[c]);
+        levelKeys[c].emplace_back(prefixKeys[c]);
+      }
+      if (sharing[c]) {
+        continue;
+      }
+      // levels that a stored record covers with the same gates so far are
+      // replayed after the simulation of this level
+      if (caching) {
+        auto& candidates = records[c];
+        candidates.erase(
+            std::remove_if(candidates.begin(), candidates.end(),
+                           [&](const GeneratorCache::Record& record) {
+                             return record.levels() <= levelCnt ||
+                                    record.levelKey(levelCnt) != prefixKeys[c];
+                           }),
+            candidates.end());
+        if (!candidates.empty()) {
+          continue;
+        }
+      }
+      simulated[c] = true;
+      for (std::size_t i = 0U; i < states[c].size(); i++) {
+        work.emplace_back(c, i);
+      }
     }
-    for (auto& state : states) {
-      auto        currLevelGen = state.getLevelGenerator();
-      auto        inspair      = generators.emplace(currLevelGen, uniqueGenCnt);
-      std::size_t id;
-      if (inspair.second) {
-        id = uniqueGenCnt;
-        uniqueGenCnt++;
-      } else {
-        id = generators.at(currLevelGen);
+
+    // apply all gates of the level to every input state of every circuit. The
+    // states are independent, so they are simulated in parallel, including
+    // the refresh of their fingerprints and the lookup of known generators.
+    known.assign(work.size(), std::nullopt);
+    {
+      QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::Simulation);
+      forEachState(work.size(), [&](const std::size_t k) {
+        const auto [c, i] = work[k];
+        auto& state       = states[c][i];
+        if (stale[c]) { // restored from the generator the last replay ended in
+          const auto id = state.prevGenId;
+          state.tableau = Tableau::fromWords(generators.words(id),
+                                             generators.qubits(id),
+                                             generators.rows(id));
+        }
+        for (const auto& gate : levels[c]) {
+          applyGate(state, gate);
+        }
+        known[k] = generators.find(state.tableau);
+      });
+    }
+
+    // add new generators in circuit and input order, so that ids do not
+    // depend on the schedule
+    QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::Interning);
+    for (std::size_t k = 0U; k < work.size(); k++) {
+      const auto [c, i] = work[k];
+      auto& state       = states[c][i];
+      auto  id          = known[k].value_or(0U);
+      auto  added       = false;
+      if (!known[k].has_value()) {
+        std::tie(id, added) = generators.intern(state.tableau);
       }
-      representation.idGeneratorMap.emplace(id, currLevelGen);
-      representation.generatorMappings.at(levelCnt).emplace(state.prevGenId,
-                                                            id);
+      QUSAT_PROFILE_COUNT(stats.profile,
+                          added ? ProfileCounter::InterningMisses
+                                : ProfileCounter::InterningHits,
+                          1U);
+      QUSAT_PROFILE_COUNT(stats.profile, ProfileCounter::GatesApplied,
+                          levels[c].size());
+      layers[c].emplace(state.prevGenId, id);
       state.prevGenId = id;
+      stale[c]        = false;
+    }
+    // replay the circuits that were not simulated, their tableaus stay behind
+    for (std::size_t c = 0U; caching && c < nrOfCircuits; c++) {
+      if (!active[c] || sharing[c] || records[c].empty()) {
+        continue;
+      }
+      const auto& record  = records[c].front();
+      auto&       mapping = layers[c];
+      for (std::size_t i = 0U; i < states[c].size(); i++) {
+        auto&      state = states[c][i];
+        const auto id    = generators
+                            .intern(Tableau::fromWords(
+                                record.generator(levelCnt + 1U, i),
+                                record.qubits(), record.rows()))
+                            .first;
+        mapping.emplace(state.prevGenId, id);
+        state.prevGenId = id;
+      }
+      stale[c] = true;
+      stats.nrOfCachedLevels++;
+    }
+    for (std::size_t c = 1U; c < nrOfCircuits; c++) {
+      if (sharing[c]) {
+        layers[c] = layers.front();
+      }
+    }
+    // the mappings are compressed as they are complete, so levels composed
+    // away are never held for the whole circuit
+    for (std::size_t c = 0U; c < nrOfCircuits; c++) {
+      if (!active[c]) {
+        continue;
+      }
+      for (auto& chain : chains[c]) {
+        chain.push_back(layers[c].at(chain.back()));
+      }
+      appendLevel(representations[c], std::move(layers[c]), levelCnt,
+                  configuration.levelCompression);
     }
   }
+  // store every circuit that was not entirely replayed, once per distinct
+  // inputs and levels
+  for (std::size_t c = 0U; caching && c < nrOfCircuits; c++) {
+    bool stored = false;
+    for (std::size_t other = 0U; other < c && !stored; other++) {
+      stored = simulated[other] && inputKeys[other] == inputKeys[c] &&
+               levelKeys[other] == levelKeys[c];
+    }
+    if (!simulated[c] || stored) {
+      continue;
+    }
+    cache->store(inputKeys[c], levelKeys[c], chains[c], generators);
+  }
+
+  // follow the mappings from the input generators to the output generators
+  for (auto& representation : representations) {
+    representation.outputGenerators = representation.inputGenerators;
+    for (auto& id : representation.outputGenerators) {
+      for (const auto& layer : representation.generatorMappings) {
+        id = layer.at(id);
+      }
+    }
+  }
+  QUSAT_PROFILE_COUNT(stats.profile, ProfileCounter::BytesAllocated,
+                      generators.bytes() - bytesBefore);
   auto after = std::chrono::high_resolution_clock::now();
   stats.preprocTime += static_cast<std::size_t>(
       std::chrono::duration_cast<std::chrono::milliseconds>(after - before)
           .count());
-  return representation;
+  return representations;
+}
+
+void SatEncoder::forEachState(const std::size_t nrOfStates,
+                              const std::function<void(std::size_t)>& body) {
+  if (nrOfStates < 2U || configuration.nThreads == 1U) {
+    for (std::size_t i = 0U; i < nrOfStates; i++) {
+      body(i);
+    }
+    return;
+  }
+  if (!pool) {
+    pool = configuration.nThreads == 0U
+               ? ThreadPool::shared()
+               : std::make_shared<ThreadPool>(configuration.nThreads);
+  }
+  pool->parallelFor(nrOfStates, body);
 }
 
-// construct z3 instance from preprocessing information
-void SatEncoder::constructSatInstance(
-    const CircuitRepresentation& circuitRepresentation, z3::solver& solver) {
+void SatEncoder::applyGate(QState& state, const LevelGate& gate) {
+  auto&      tableau = state.tableau;
+  const auto target  = gate.target;
+  switch (gate.type) {
+  case qc::OpType::H:
+    tableau.applyH(target);
+    break;
+  case qc::OpType::S:
+    tableau.applyS(target);
+    break;
+  case qc::OpType::Sdg:
+    tableau.applySdg(target);
+    break;
+  case qc::OpType::SX:
+  case qc::OpType::V:
+    tableau.applySX(target);
+    break;
+  case qc::OpType::SXdg:
+  case qc::OpType::Vdg:
+    tableau.applySXdg(target);
+    break;
+  case qc::OpType::Z:
+    if (gate.controlled) {
+      tableau.applyCZ(gate.control, target);
+    } else {
+      tableau.applyZ(target);
+    }
+    break;
+  case qc::OpType::Y:
+    if (gate.controlled) {
+      tableau.applyCY(gate.control, target);
+    } else {
+      tableau.applyY(target);
+    }
+    break;
+  case qc::OpType::X:
+    if (gate.controlled) { // CNOT
+      tableau.applyCNOT(gate.control, target);
+    } else {
+      tableau.applyX(target);
+    }
+    break;
+  case qc::OpType::SWAP:
+    tableau.applySwap(gate.control, target);
+    break;
+  case qc::OpType::iSWAP:
+    tableau.applyISwap(gate.control, target);
+    break;
+  case qc::OpType::iSWAPdg:
+    tableau.applyISwapdg(gate.control, target);
+    break;
+  case qc::OpType::DCX:
+    tableau.applyDCX(gate.control, target);
+    break;
+  case qc::OpType::ECR:
+    tableau.applyECR(gate.control, target);
+    break;
+  default:
+    break;
+  }
+}
+
+// construct CNF instance from preprocessing information
+std::vector<std::vector<CnfBuilder::Literal>>
+SatEncoder::constructSatInstance(const CircuitRepresentation& representation,
+                                 CnfBuilder&                  cnf) {
   auto before = std::chrono::high_resolution_clock::now();
+  QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::ConstraintBuilding);
+  [[maybe_unused]] const auto literalsBefore = cnf.literals().size();
+  stats.levelCompression = toString(configuration.levelCompression);
   // number of unique generators that need to be encoded
   const auto generatorCnt = generators.size();
   if (generatorCnt < 1) {
     std::cerr << "Zero generators computed" << std::endl;
-    return;
+    return {};
   }
   stats.nrOfGenerators = generatorCnt;
-  // bitwidth required to encode the generators
-  auto bitwidth = static_cast<std::size_t>(std::ceil(std::log2(generatorCnt)));
-  if (bitwidth < 1 && generatorCnt == 1) {
-    bitwidth = 1;
-  }
-  // whether the number of generators is a power of two or not
-  bool blockingConstraintsNeeded =
-      std::log2(generatorCnt) < static_cast<double>(bitwidth);
-
-  // z3 context used throughout this function
-  auto& ctx = solver.ctx();
 
-  const auto depth = circuitRepresentation.generatorMappings.size();
+  const auto depth = representation.generatorMappings.size();
+  const GeneratorEncoding encoding(configuration.encoding, generatorCnt);
+  stats.encoding = toString(encoding.type());
 
-  std::vector<z3::expr> vars{};
+  std::vector<std::vector<CnfBuilder::Literal>> vars{};
   vars.reserve(depth + 1U);
-  std::string bvName = "x^";
-
   for (std::size_t k = 0U; k <= depth; k++) {
-    // create bitvector [x^k]_2 with respective bitwidth for each level k of ckt
-    std::stringstream ss{};
-    ss << bvName << k; //
-    vars.emplace_back(
-        ctx.bv_const(ss.str().c_str(), static_cast<unsigned>(bitwidth)));
+    // create variable x^k holding the generator id of each level k of ckt
+    vars.emplace_back(encoding.newLevel(cnf));
     stats.nrOfSatVars++;
   }
 
   for (std::size_t i = 0U; i < depth; i++) {
-    const auto layer = circuitRepresentation.generatorMappings.at(
+    const auto& layer = representation.generatorMappings.at(
         i); // generator<>generator map for level i
-    for (const auto& [from, to] : layer) {
-      const auto g1 =
-          generators.at(circuitRepresentation.idGeneratorMap.at(from));
-      const auto g2 =
-          generators.at(circuitRepresentation.idGeneratorMap.at(to));
-
-      // create [x^l]_2 = i => [x^l']_2 = k for each generator mapping
-      const auto left = vars[i] == ctx.bv_val(static_cast<std::uint64_t>(g1),
-                                              static_cast<unsigned>(bitwidth));
-      const auto right =
-          vars[i + 1U] == ctx.bv_val(static_cast<std::uint64_t>(g2),
-                                     static_cast<unsigned>(bitwidth));
-      const auto cons = implies(left, right);
-      solver.add(cons);
+    for (const auto& [g1, g2] : layer) {
+      // create x^l = i => x^l' = k for each generator mapping
+      cnf.addImplication(encoding.equals(vars[i], g1),
+                         encoding.equals(vars[i + 1U], g2));
       stats.nrOfFunctionalConstr++;
     }
   }
-
-  if (blockingConstraintsNeeded) {
-    for (const auto& var : vars) {
-      const auto cons =
-          ult(var, ctx.bv_val(static_cast<std::uint64_t>(generatorCnt),
-                              static_cast<unsigned>(bitwidth)));
-      solver.add(cons); // [x^l]_2 < m
-    }
-  }
-  auto after                = std::chrono::high_resolution_clock::now();
-  stats.satConstructionTime = static_cast<std::size_t>(
+  QUSAT_PROFILE_COUNT(stats.profile, ProfileCounter::BytesAllocated,
+                      (cnf.literals().size() - literalsBefore) *
+                          sizeof(CnfBuilder::Literal));
+  auto after = std::chrono::high_resolution_clock::now();
+  stats.satConstructionTime += static_cast<std::size_t>(
       std::chrono::duration_cast<std::chrono::milliseconds>(after - before)
           .count());
+  return vars;
 }
 
-void SatEncoder::constructMiterInstance(const CircuitRepresentation& circOneRep,
-                                        const CircuitRepresentation& circTwoRep,
-                                        z3::solver&                  solver) {
+std::vector<std::vector<CnfBuilder::Literal>>
+SatEncoder::constructMiterInstance(const CircuitRepresentation& circuitOne,
+                                   const CircuitRepresentation& circuitTwo,
+                                   CnfBuilder&                  cnf) {
   auto before = std::chrono::high_resolution_clock::now();
+  QUSAT_PROFILE_PHASE(stats.profile, ProfilePhase::ConstraintBuilding);
+  [[maybe_unused]] const auto literalsBefore = cnf.literals().size();
+  stats.levelCompression = toString(configuration.levelCompression);
   // number of unique generators that need to be encoded
   const auto generatorCnt = generators.size();
   if (generatorCnt < 1) {
     std::cerr << "Zero generators computed" << std::endl;
-    return;
+    return {};
   }
   stats.nrOfGenerators = generatorCnt;
-  // bitwidth required to encode the generators
-  auto bitwidth = static_cast<std::size_t>(std::ceil(std::log2(generatorCnt)));
-  if (bitwidth < 1 && generatorCnt == 1) {
-    bitwidth = 1;
-  }
-
-  // whether the number of generators is a power of two or not
-  bool blockingConstraintsNeeded =
-      std::log2(generatorCnt) < static_cast<double>(bitwidth);
-  // z3 context used throughout this function
-  auto& ctx = solver.ctx();
-
-  /// encode first circuit
-  const auto            depthOne = circOneRep.generatorMappings.size();
-  std::vector<z3::expr> varsOne{};
-  varsOne.reserve(depthOne + 1U);
-  std::string bvName = "x^";
-
-  for (std::size_t k = 0U; k <= depthOne; k++) {
-    // create bitvector [x^k]_2 with respective bitwidth for each level k of ckt
-    std::stringstream ss{};
-    ss << bvName << k; //
-    const auto tmp =
-        ctx.bv_const(ss.str().c_str(), static_cast<unsigned>(bitwidth));
-    varsOne.emplace_back(tmp);
-    stats.nrOfSatVars++;
-  }
 
-  for (std::size_t i = 0U; i < depthOne; i++) {
-    const auto layer = circOneRep.generatorMappings.at(
-        i); // generator<>generator map for level i
-    for (const auto& [from, to] : layer) {
-      const auto g1 = generators.at(circOneRep.idGeneratorMap.at(from));
-      const auto g2 = generators.at(circOneRep.idGeneratorMap.at(to));
-
-      // create [x^l]_2 = i <=> [x^l']_2 = k for each generator mapping
-      const auto left =
-          varsOne[i] == ctx.bv_val(static_cast<std::uint64_t>(g1),
-                                   static_cast<unsigned>(bitwidth));
-      const auto right =
-          varsOne[i + 1U] == ctx.bv_val(static_cast<std::uint64_t>(g2),
-                                        static_cast<unsigned>(bitwidth));
-      const auto cons = (left == right);
-      solver.add(cons);
-      stats.nrOfFunctionalConstr++;
-    }
-  }
+  const GeneratorEncoding encoding(configuration.encoding, generatorCnt);
+  stats.encoding = toString(encoding.type());
 
-  if (blockingConstraintsNeeded) {
-    for (const auto& var : varsOne) {
-      const auto cons =
-          ult(var, ctx.bv_val(static_cast<std::uint64_t>(generatorCnt),
-                              static_cast<unsigned>(bitwidth)));
-      solver.add(cons); // [x^l]_2 < m
+  // encodes the level variables and generator mappings of one circuit
+  const auto encodeCircuit = [&](const CircuitRepresentation& representation) {
+    const auto depth = representation.generatorMappings.size();
+    std::vector<std::vector<CnfBuilder::Literal>> vars{};
+    vars.reserve(depth + 1U);
+    for (std::size_t k = 0U; k <= depth; k++) {
+      // create variable x^k holding the generator id of each level k
+      vars.emplace_back(encoding.newLevel(cnf));
+      stats.nrOfSatVars++;
     }
-  }
-  /// encode second circuit
-  auto                  depthTwo = circTwoRep.generatorMappings.size();
-  std::vector<z3::expr> varsTwo{};
-  varsOne.reserve(depthTwo + 1U);
-  bvName = "x'^";
 
-  for (std::size_t k = 0U; k <= depthTwo; k++) {
-    // create bitvector [x^k]_2 with respective bitwidth for each level k of ckt
-    std::stringstream ss{};
-    ss << bvName << k; //
-    const auto tmp =
-        ctx.bv_const(ss.str().c_str(), static_cast<unsigned>(bitwidth));
-    varsTwo.emplace_back(tmp);
-    stats.nrOfSatVars++;
-  }
-
-  for (std::size_t i = 0U; i < depthTwo; i++) {
-    const auto layer = circTwoRep.generatorMappings.at(
-        i); // generator<>generator map for level i
-    for (const auto& [from, to] : layer) {
-      const auto g1 = generators.at(circTwoRep.idGeneratorMap.at(from));
-      const auto g2 = generators.at(circTwoRep.idGeneratorMap.at(to));
-
-      // create [x^l]_2 = i <=> [x^l']_2 = k for each generator mapping
-      const auto left =
-          varsTwo[i] == ctx.bv_val(static_cast<std::uint64_t>(g1),
-                                   static_cast<unsigned>(bitwidth));
-      const auto right =
-          varsTwo[i + 1U] == ctx.bv_val(static_cast<std::uint64_t>(g2),
-                                        static_cast<unsigned>(bitwidth));
-      const auto cons = (left == right);
-      solver.add(cons);
-      stats.nrOfFunctionalConstr++;
+    for (std::size_t i = 0U; i < depth; i++) {
+      const auto& layer = representation.generatorMappings.at(
+          i); // generator<>generator map for level i
+      for (const auto& [g1, g2] : layer) {
+        // create x^l = i <=> x^l' = k for each generator mapping
+        const auto left  = encoding.equals(vars[i], g1);
+        const auto right = encoding.equals(vars[i + 1U], g2);
+        cnf.addImplication(left, right);
+        cnf.addImplication(right, left);
+        stats.nrOfFunctionalConstr++;
+      }
     }
-  }
+    return vars;
+  };
+
+  const auto varsOne = encodeCircuit(circuitOne);
+  const auto varsTwo = encodeCircuit(circuitTwo);
 
-  if (blockingConstraintsNeeded) {
-    for (const auto& var : varsTwo) {
-      const auto cons =
-          ult(var, ctx.bv_val(static_cast<std::uint64_t>(generatorCnt),
-                              static_cast<unsigned>(bitwidth)));
-      solver.add(cons); // [x^l]_2 < m
-    }
-  }
   // create miter structure
   // if initial signals are the same, then the final signals have to be equal as
   // well
-  const auto equalInputs    = varsOne.front() == varsTwo.front();
-  const auto unequalOutputs = varsOne.back() != varsTwo.back();
-  const auto nrOfInputs =
-      ctx.bv_val(static_cast<std::uint64_t>(nrOfInputGenerators),
-                 static_cast<unsigned>(bitwidth));
-  const auto input1 = ult(varsOne.front(), nrOfInputs);
-  const auto input2 = ult(varsTwo.front(), nrOfInputs);
-
-  solver.add(equalInputs);
-  solver.add(unequalOutputs);
-  solver.add(input1);
-  solver.add(input2);
-  auto after                = std::chrono::high_resolution_clock::now();
-  stats.satConstructionTime = static_cast<std::size_t>(
+  encoding.addEqual(cnf, varsOne.front(), varsTwo.front());
+  encoding.addNotEqual(cnf, varsOne.back(), varsTwo.back());
+  encoding.addLessThan(cnf, varsOne.front(), nrOfInputGenerators);
+  encoding.addLessThan(cnf, varsTwo.front(), nrOfInputGenerators);
+
+  std::vector<std::vector<CnfBuilder::Literal>> selectors{};
+  selectors.reserve(nrOfInputGenerators);
+  for (std::size_t id = 0U; id < nrOfInputGenerators; id++) {
+    selectors.emplace_back(encoding.equals(varsOne.front(), id));
+  }
+
+  QUSAT_PROFILE_COUNT(stats.profile, ProfileCounter::BytesAllocated,
+                      (cnf.literals().size() - literalsBefore) *
+                          sizeof(CnfBuilder::Literal));
+  auto after = std::chrono::high_resolution_clock::now();
+  stats.satConstructionTime += static_cast<std::size_t>(
       std::chrono::duration_cast<std::chrono::milliseconds>(after - before)
           .count());
+  return selectors;
 }
 
-bool SatEncoder::isClifford(const qc::QuantumComputation& qc) {
-  qc::OpType opType;
-  for (const auto& op : qc) {
-    opType = op->getType();
-    if (opType != qc::OpType::H && opType != qc::OpType::S &&
-        opType != qc::OpType::Sdg && opType != qc::OpType::X &&
-        opType != qc::OpType::Z && opType != qc::OpType::Y &&
-        opType != qc::OpType::I) {
-      return false;
-    }
+void SatEncoder::appendLevel(
+    CircuitRepresentation&               representation,
+    std::map<std::size_t, std::size_t>&& layer, const std::size_t level,
+    const LevelCompression compression) {
+  auto& mappings = representation.generatorMappings;
+  // a level that maps every generator to itself is dropped
+  if (compression != LevelCompression::None &&
+      std::all_of(layer.begin(), layer.end(), [](const auto& mapping) {
+        return mapping.first == mapping.second;
+      })) {
+    return;
   }
-  return true;
-}
-
-std::vector<std::vector<bool>> SatEncoder::QState::getLevelGenerator() const {
-  std::size_t                    size = (2U * n) + 1U;
-  std::vector<std::vector<bool>> result{};
-
-  for (std::size_t i = 0U; i < n; i++) {
-    std::vector<bool> gen(size);
-    for (std::size_t j = 0U; j < n; j++) {
-      gen[j] = x.at(i).at(j);
-    }
-    for (std::size_t j = 0; j < n; j++) {
-      gen[n + j] = z.at(i).at(j);
-    }
-    gen[n + n] = r.at(i) == 1;
-    result.emplace_back(gen);
+  if (compression != LevelCompression::Full || mappings.empty()) {
+    mappings.push_back(std::move(layer));
+    representation.levelIndex.push_back(level);
+    return;
   }
+  // compose the level into the previous one. Every generator the previous
+  // level maps to is a generator this level maps from.
+  for (auto& mapping : mappings.back()) {
+    mapping.second = layer.at(mapping.second);
+  }
+  representation.levelIndex.back() = level;
+}
 
-  return result;
+bool SatEncoder::isClifford(const qc::QuantumComputation& qc) {
+  return std::all_of(qc.begin(), qc.end(), [](const auto& op) {
+    return CircuitGateSource::isSupported(*op);
+  });
 }
 
 SatEncoder::QState SatEncoder::initializeState(unsigned long      nrOfQubits,
                                                const std::string& input) {
   QState result;
-  result.n = nrOfQubits;
-  result.x =
-      std::vector<std::vector<bool>>(nrOfQubits, std::vector<bool>(nrOfQubits));
-  result.z =
-      std::vector<std::vector<bool>>(nrOfQubits, std::vector<bool>(nrOfQubits));
-  result.r = std::vector<int>(nrOfQubits, 0);
-
-  for (std::size_t i = 0U; i < nrOfQubits; i++) {
-    result.z[i][i] = true; // initial 0..0 state corresponds to x matrix all
-                           // zero and z matrix = Id_n
-  }
-
-  if (!input.empty()) { //
-    for (std::size_t i = 0U; i < input.length(); i++) {
-      switch (input[i]) {
-      case 'Z': // stab by -Z = |1>
-        result.applyH(i);
-        result.applyS(i);
-        result.applyS(i);
-        result.applyH(i);
-        break;
-      case 'x': // stab by X = |+>
-        result.applyH(i);
-        break;
-      case 'X': // stab by -X = |->
-        result.applyH(i);
-        result.applyS(i);
-        result.applyS(i);
-        break;
-      case 'y': // stab by Y = |0> + i|1>
-        result.applyH(i);
-        result.applyS(i);
-        break;
-      case 'Y': // stab by -Y = |0> - i|1>
-        result.applyH(i);
-        result.applyS(i);
-        result.applyS(i);
-        result.applyS(i);
-        break;
-      default:;
-      }
+  result.tableau = Tableau(nrOfQubits);
+
+  // every character selects the single-qubit Clifford that prepares the
+  // respective stabilizer state from |0>, applied in one sweep
+  const auto zero = SingleQubitClifford{};
+  const auto h    = SingleQubitClifford::h();
+  for (std::size_t i = 0U; i < input.length(); i++) {
+    auto prep = zero;
+    switch (input[i]) {
+    case 'Z': // stab by -Z = |1>
+      prep = SingleQubitClifford::x();
+      break;
+    case 'x': // stab by X = |+>
+      prep = h;
+      break;
+    case 'X': // stab by -X = |->
+      prep = h.then(SingleQubitClifford::z());
+      break;
+    case 'y': // stab by Y = |0> + i|1>
+      prep = h.then(SingleQubitClifford::s());
+      break;
+    case 'Y': // stab by -Y = |0> - i|1>
+      prep = h.then(SingleQubitClifford::sdg());
+      break;
+    default:;
     }
+    result.tableau.applyClifford(i, prep);
   }
   return result;
 }
 const Statistics& SatEncoder::getStats() const { return stats; }
-
-void SatEncoder::QState::applyCNOT(unsigned long control,
-                                   unsigned long target) {
-  if (target >= n || control >= n) {
-    return;
-  }
-  for (std::size_t i = 0U; i < n; ++i) {
-    r[i] ^= (x[i][control] * z[i][target]) * (x[i][target] ^ z[i][control] ^ 1);
-    x[i][target]  = x[i][target] ^ x[i][control];
-    z[i][control] = z[i][control] ^ z[i][target];
-  }
-}
-
-void SatEncoder::QState::applyH(unsigned long target) {
-  if (target >= n) {
-    return;
-  }
-  for (std::size_t i = 0U; i < n; i++) {
-    r[i] ^= x[i][target] * z[i][target];
-    x[i][target] = x[i][target] ^ z[i][target];
-    z[i][target] = x[i][target] ^ z[i][target];
-    x[i][target] = x[i][target] ^ z[i][target];
-  }
-}
-
-void SatEncoder::QState::applyS(unsigned long target) {
-  if (target >= n) {
-    return;
-  }
-  for (std::size_t i = 0U; i < n; ++i) {
-    r[i] ^= x[i][target] * z[i][target];
-    z[i][target] = z[i][target] ^ x[i][target];
-  }
-}
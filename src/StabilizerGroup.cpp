@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "StabilizerGroup.hpp"
+
+#include "Tableau.hpp"
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+bool getBit(const std::uint64_t* words, const std::size_t index) {
+  return ((words[index / Tableau::WORD_BITS] >> (index % Tableau::WORD_BITS)) &
+          1U) != 0U;
+}
+
+void setBit(std::uint64_t* words, const std::size_t index) {
+  words[index / Tableau::WORD_BITS] |= std::uint64_t{1}
+                                       << (index % Tableau::WORD_BITS);
+}
+
+int popcount(const std::uint64_t word) {
+  return static_cast<int>(std::bitset<Tableau::WORD_BITS>(word).count());
+}
+} // namespace
+
+StabilizerGroup::StabilizerGroup(const Tableau& tableau)
+    : StabilizerGroup(tableau.raw().data(), tableau.qubits(),
+                      tableau.rows()) {}
+
+StabilizerGroup::StabilizerGroup(const std::uint64_t* words,
+                                 const std::size_t    nrOfQubits,
+                                 const std::size_t    nrOfRows)
+    : n(nrOfQubits),
+      nrOfWords((nrOfQubits + Tableau::WORD_BITS - 1U) / Tableau::WORD_BITS),
+      data(2U * nrOfQubits * nrOfWords, 0U), phases(nrOfQubits, 0U) {
+  // transpose the stabilizer rows of the column-major tableau
+  const auto columnWords =
+      (nrOfRows + Tableau::WORD_BITS - 1U) / Tableau::WORD_BITS;
+  const auto offset = nrOfRows - n;
+  for (std::size_t q = 0U; q < n; q++) {
+    const auto* xColumn = words + (q * columnWords);
+    const auto* zColumn = words + ((n + q) * columnWords);
+    for (std::size_t row = 0U; row < n; row++) {
+      if (getBit(xColumn, offset + row)) {
+        setBit(xWords(row), q);
+      }
+      if (getBit(zColumn, offset + row)) {
+        setBit(zWords(row), q);
+      }
+    }
+  }
+  const auto* phaseColumn = words + (2U * n * columnWords);
+  for (std::size_t row = 0U; row < n; row++) {
+    phases[row] = getBit(phaseColumn, offset + row) ? 1U : 0U;
+  }
+  canonicalize();
+}
+
+bool StabilizerGroup::x(const std::size_t row, const std::size_t qubit) const {
+  return getBit(data.data() + (2U * row * nrOfWords), qubit);
+}
+
+bool StabilizerGroup::z(const std::size_t row, const std::size_t qubit) const {
+  return getBit(data.data() + (((2U * row) + 1U) * nrOfWords), qubit);
+}
+
+bool StabilizerGroup::pivot(const std::size_t row,
+                            const std::size_t column) const {
+  return column < n ? x(row, column) : z(row, column - n);
+}
+
+void StabilizerGroup::rowsum(const std::size_t target,
+                             const std::size_t source) {
+  auto*       xt = xWords(target);
+  auto*       zt = zWords(target);
+  const auto* xs = data.data() + (2U * source * nrOfWords);
+  const auto* zs = data.data() + (((2U * source) + 1U) * nrOfWords);
+
+  // exponent of i picked up by multiplying the Paulis of every qubit, i.e.,
+  // the sum of g(x_s, z_s, x_t, z_t) from Aaronson and Gottesman
+  int exponent = 2 * (phases[target] + phases[source]);
+  for (std::size_t w = 0U; w < nrOfWords; w++) {
+    const auto x1 = xs[w];
+    const auto z1 = zs[w];
+    const auto x2 = xt[w];
+    const auto z2 = zt[w];
+    // Y * Z = iX, Y * X = -iZ, X * Y = iZ, X * Z = -iY, Z * X = iY, Z * Y = -iX
+    const auto plus = (x1 & z1 & z2 & ~x2) | (x1 & ~z1 & x2 & z2) |
+                      (~x1 & z1 & x2 & ~z2);
+    const auto minus = (x1 & z1 & x2 & ~z2) | (x1 & ~z1 & ~x2 & z2) |
+                       (~x1 & z1 & x2 & z2);
+    exponent += popcount(plus) - popcount(minus);
+    xt[w] = x1 ^ x2;
+    zt[w] = z1 ^ z2;
+  }
+  // rows of a stabilizer group commute, so the exponent is even
+  phases[target] = (((exponent % 4) + 4) % 4) == 2 ? 1U : 0U;
+}
+
+void StabilizerGroup::swapRows(const std::size_t lhs, const std::size_t rhs) {
+  for (std::size_t w = 0U; w < 2U * nrOfWords; w++) {
+    std::swap(data[(2U * lhs * nrOfWords) + w],
+              data[(2U * rhs * nrOfWords) + w]);
+  }
+  std::swap(phases[lhs], phases[rhs]);
+}
+
+void StabilizerGroup::canonicalize() {
+  // Gauss-Jordan elimination over the x columns and then the z columns
+  std::size_t rank = 0U;
+  for (std::size_t column = 0U; column < 2U * n && rank < n; column++) {
+    auto row = rank;
+    while (row < n && !pivot(row, column)) {
+      row++;
+    }
+    if (row == n) {
+      continue;
+    }
+    swapRows(rank, row);
+    for (std::size_t other = 0U; other < n; other++) {
+      if (other != rank && pivot(other, column)) {
+        rowsum(other, rank);
+      }
+    }
+    rank++;
+  }
+}
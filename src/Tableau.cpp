@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Tableau.hpp"
+
+#include "Hashing.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace {
+using hashing::mix;
+
+bool getBit(const std::uint64_t* column, const std::size_t row) {
+  return ((column[row / Tableau::WORD_BITS] >> (row % Tableau::WORD_BITS)) &
+          1U) != 0U;
+}
+
+// two independent lanes seeded with the column index, so that equal contents
+// in different columns do not cancel out in the XOR of all column hashes
+Fingerprint hashColumn(const std::uint64_t* words, const std::size_t count,
+                       const std::size_t column) {
+  Fingerprint hash{mix(column + 0x9e3779b97f4a7c15ULL),
+                   mix(~column + 0x632be59bd9b4e019ULL)};
+  for (std::size_t w = 0U; w < count; w++) {
+    hash.lo = mix(hash.lo ^ words[w]);
+    hash.hi = mix(hash.hi + (words[w] * 0xc2b2ae3d27d4eb4fULL) + w);
+  }
+  return hash;
+}
+} // namespace
+
+Tableau::Tableau(const std::size_t nrOfQubits)
+    : Tableau(nrOfQubits, false) {}
+
+Tableau Tableau::identity(const std::size_t nrOfQubits) {
+  return Tableau(nrOfQubits, true);
+}
+
+Tableau Tableau::fromWords(const std::uint64_t* words,
+                           const std::size_t nrOfQubits,
+                           const std::size_t nrOfRows) {
+  // all columns are dirty after construction, so the fingerprint is computed
+  // from the copied words
+  Tableau tableau(nrOfQubits, nrOfRows != nrOfQubits);
+  std::copy(words, words + tableau.data.size(), tableau.data.begin());
+  return tableau;
+}
+
+Tableau::Tableau(const std::size_t nrOfQubits, const bool destabilizers)
+    : n(nrOfQubits), nrOfRows(destabilizers ? 2U * nrOfQubits : nrOfQubits),
+      nrOfWords((nrOfRows + WORD_BITS - 1U) / WORD_BITS),
+      data(((2U * nrOfQubits) + 1U) * nrOfWords, 0U),
+      columnHashes(columns()), dirty(columns(), true) {
+  const auto offset = nrOfRows - n;
+  for (std::size_t i = 0U; i < n; i++) {
+    // initial 0..0 state corresponds to x matrix all zero and z matrix = Id_n,
+    // the destabilizers above it to x matrix = Id_n and z matrix all zero
+    if (destabilizers) {
+      xWords(i)[i / WORD_BITS] |= std::uint64_t{1} << (i % WORD_BITS);
+    }
+    const auto row = offset + i;
+    zWords(i)[row / WORD_BITS] |= std::uint64_t{1} << (row % WORD_BITS);
+  }
+  dirtyColumns.reserve(columns());
+  for (std::size_t c = 0U; c < columns(); c++) {
+    dirtyColumns.emplace_back(c);
+  }
+}
+
+void Tableau::markDirty(const std::size_t column) {
+  if (!dirty[column]) {
+    dirty[column] = true;
+    dirtyColumns.emplace_back(column);
+  }
+}
+
+void Tableau::markQubitDirty(const std::size_t qubit) {
+  markDirty(qubit);
+  markDirty(n + qubit);
+  markDirty(2U * n);
+}
+
+const Fingerprint& Tableau::fingerprint() const {
+  for (const auto column : dirtyColumns) {
+    combined ^= columnHashes[column];
+    columnHashes[column] =
+        hashColumn(data.data() + (column * nrOfWords), nrOfWords, column);
+    combined ^= columnHashes[column];
+    dirty[column] = false;
+  }
+  dirtyColumns.clear();
+  return combined;
+}
+
+bool Tableau::x(const std::size_t row, const std::size_t qubit) const {
+  return getBit(xColumn(qubit), row);
+}
+
+bool Tableau::z(const std::size_t row, const std::size_t qubit) const {
+  return getBit(zColumn(qubit), row);
+}
+
+bool Tableau::r(const std::size_t row) const { return getBit(phases(), row); }
+
+std::vector<std::vector<bool>> Tableau::toGenerator() const {
+  const std::size_t              size = (2U * n) + 1U;
+  std::vector<std::vector<bool>> result(nrOfRows, std::vector<bool>(size));
+
+  for (std::size_t j = 0U; j < n; j++) {
+    const auto* xs = xColumn(j);
+    const auto* zs = zColumn(j);
+    for (std::size_t i = 0U; i < nrOfRows; i++) {
+      result[i][j]     = getBit(xs, i);
+      result[i][n + j] = getBit(zs, i);
+    }
+  }
+  for (std::size_t i = 0U; i < nrOfRows; i++) {
+    result[i][n + n] = r(i);
+  }
+  return result;
+}
+
+void Tableau::applyCNOT(const std::size_t control, const std::size_t target) {
+  if (target >= n || control >= n) {
+    return;
+  }
+  kernels->cnot(xWords(control), zWords(control), xWords(target),
+                zWords(target), phaseWords(), nrOfWords);
+  markDirty(target);
+  markDirty(n + control);
+  markDirty(2U * n);
+}
+
+void Tableau::applyCZ(const std::size_t control, const std::size_t target) {
+  if (target >= n || control >= n || target == control) {
+    return;
+  }
+  kernels->cz(xWords(control), zWords(control), xWords(target), zWords(target),
+              phaseWords(), nrOfWords);
+  // CZ only changes the z columns and the phases
+  markDirty(n + control);
+  markDirty(n + target);
+  markDirty(2U * n);
+}
+
+void Tableau::applyCY(const std::size_t control, const std::size_t target) {
+  applyTwoQubit(kernels->cy, control, target);
+}
+
+void Tableau::applySwap(const std::size_t first, const std::size_t second) {
+  applyTwoQubit(kernels->swap, first, second);
+}
+
+void Tableau::applyISwap(const std::size_t first, const std::size_t second) {
+  applyTwoQubit(kernels->iswap, first, second);
+}
+
+void Tableau::applyISwapdg(const std::size_t first, const std::size_t second) {
+  applyTwoQubit(kernels->iswapdg, first, second);
+}
+
+void Tableau::applyDCX(const std::size_t first, const std::size_t second) {
+  applyTwoQubit(kernels->dcx, first, second);
+}
+
+void Tableau::applyECR(const std::size_t first, const std::size_t second) {
+  applyTwoQubit(kernels->ecr, first, second);
+}
+
+void Tableau::applyTwoQubit(const CliffordKernels::TwoQubitKernel kernel,
+                            const std::size_t                     first,
+                            const std::size_t                     second) {
+  if (first >= n || second >= n || first == second) {
+    return;
+  }
+  kernel(xWords(first), zWords(first), xWords(second), zWords(second),
+         phaseWords(), nrOfWords);
+  markQubitDirty(first);
+  markQubitDirty(second);
+}
+
+void Tableau::applyH(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->h(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  markQubitDirty(target);
+}
+
+void Tableau::applyS(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->s(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  markQubitDirty(target);
+}
+
+void Tableau::applySdg(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->sdg(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  markQubitDirty(target);
+}
+
+void Tableau::applyX(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->x(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  // Pauli gates only change the phases
+  markDirty(2U * n);
+}
+
+void Tableau::applyY(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->y(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  // Pauli gates only change the phases
+  markDirty(2U * n);
+}
+
+void Tableau::applyZ(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->z(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  // Pauli gates only change the phases
+  markDirty(2U * n);
+}
+
+void Tableau::applySX(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->sx(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  markQubitDirty(target);
+}
+
+void Tableau::applySXdg(const std::size_t target) {
+  if (target >= n) {
+    return;
+  }
+  kernels->sxdg(xWords(target), zWords(target), phaseWords(), nrOfWords);
+  markQubitDirty(target);
+}
+
+void Tableau::applyClifford(const std::size_t          target,
+                            const SingleQubitClifford& gate) {
+  if (target >= n || gate.isIdentity()) {
+    return;
+  }
+  kernels->clifford(xWords(target), zWords(target), phaseWords(), nrOfWords,
+                    gate);
+  markQubitDirty(target);
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+ThreadPool::ThreadPool(std::size_t nrOfThreads) {
+  if (nrOfThreads == 0U) {
+    nrOfThreads = std::max(1U, std::thread::hardware_concurrency());
+  }
+  // the calling thread takes part in every parallelFor
+  const auto nrOfWorkers = nrOfThreads - 1U;
+  for (std::size_t i = 0U; i <= nrOfWorkers; i++) {
+    queues.emplace_back(std::make_unique<Queue>());
+  }
+  workers.reserve(nrOfWorkers);
+  for (std::size_t i = 0U; i < nrOfWorkers; i++) {
+    workers.emplace_back([this, i] { workerLoop(i + 1U); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    const std::lock_guard lock(wakeMutex);
+    stop = true;
+  }
+  wake.notify_all();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+}
+
+std::shared_ptr<ThreadPool> ThreadPool::shared() {
+  static const auto pool = std::make_shared<ThreadPool>();
+  return pool;
+}
+
+void ThreadPool::submit(std::function<void()> task) {
+  auto& queue = *queues[nextQueue++ % queues.size()];
+  {
+    const std::lock_guard lock(wakeMutex);
+    ++pending;
+  }
+  {
+    const std::lock_guard lock(queue.mutex);
+    queue.tasks.emplace_back(std::move(task));
+  }
+  wake.notify_one();
+}
+
+bool ThreadPool::runPendingTask(const std::size_t own) {
+  std::function<void()> task;
+  // own queue first (LIFO), then steal from the others (FIFO)
+  for (std::size_t i = 0U; i < queues.size() && !task; i++) {
+    auto&                 queue = *queues[(own + i) % queues.size()];
+    const std::lock_guard lock(queue.mutex);
+    if (queue.tasks.empty()) {
+      continue;
+    }
+    if (i == 0U) {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+    } else {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+    }
+  }
+  if (!task) {
+    return false;
+  }
+  --pending;
+  task();
+  return true;
+}
+
+void ThreadPool::workerLoop(const std::size_t index) {
+  while (true) {
+    if (runPendingTask(index)) {
+      continue;
+    }
+    std::unique_lock lock(wakeMutex);
+    wake.wait(lock, [this] { return stop || pending > 0U; });
+    if (stop) {
+      return;
+    }
+  }
+}
+
+void ThreadPool::parallelFor(const std::size_t                       count,
+                             const std::function<void(std::size_t)>& body) {
+  if (count == 0U) {
+    return;
+  }
+  if (workers.empty() || count == 1U) {
+    for (std::size_t i = 0U; i < count; i++) {
+      body(i);
+    }
+    return;
+  }
+
+  // a few chunks per thread so that stealing can balance uneven work
+  const auto nrOfChunks = std::min(count, 4U * size());
+  const auto chunkSize  = (count + nrOfChunks - 1U) / nrOfChunks;
+
+  std::atomic<std::size_t> remaining{(count + chunkSize - 1U) / chunkSize};
+  std::mutex               doneMutex;
+  std::condition_variable  done;
+  std::exception_ptr       error;
+
+  for (std::size_t begin = 0U; begin < count; begin += chunkSize) {
+    const auto end = std::min(count, begin + chunkSize);
+    submit([&, begin, end] {
+      try {
+        for (std::size_t i = begin; i < end; i++) {
+          body(i);
+        }
+      } catch (...) {
+        const std::lock_guard lock(doneMutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+      // decrement under the lock, the waiting thread may return right after
+      const std::lock_guard lock(doneMutex);
+      if (--remaining == 0U) {
+        done.notify_all();
+      }
+    });
+  }
+
+  // help out until all chunks have been picked up, then wait for the rest
+  while (remaining > 0U && runPendingTask(0U)) {
+  }
+  {
+    std::unique_lock lock(doneMutex);
+    done.wait(lock, [&remaining] { return remaining == 0U; });
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
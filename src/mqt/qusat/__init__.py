@@ -22,6 +22,18 @@ if sys.platform == "win32" and "Z3_ROOT" in os.environ:
     if bin_path.exists():
         os.add_dll_directory(str(bin_path))
 
-from .pyqusat import check_equivalence, generate_dimacs
+from .pyqusat import (
+    CancellationToken,
+    check_equivalence,
+    check_equivalence_batch,
+    generate_dimacs,
+    write_dimacs,
+)
 
-__all__ = ["check_equivalence", "generate_dimacs"]
+__all__ = [
+    "CancellationToken",
+    "check_equivalence",
+    "check_equivalence_batch",
+    "generate_dimacs",
+    "write_dimacs",
+]
@@ -6,14 +6,54 @@
 #
 # Licensed under the MIT License
 
-from typing import Any
+from typing import Any, Literal
 
 from mqt.core.ir import QuantumComputation
 
+class CancellationToken:
+    def __init__(self) -> None: ...
+    def cancel(self) -> None: ...
+    def cancelled(self) -> bool: ...
+
 def check_equivalence(
     circ1: QuantumComputation,
     circ2: QuantumComputation,
+    inputs: list[str] = ...,
+    backend: Literal["z3", "cdcl"] = "z3",
+    encoding: Literal["binary", "onehot", "order"] = "binary",
+    check: Literal["miter", "direct", "unitary"] = "miter",
+    cross_check: bool = False,
+    level_compression: Literal["none", "identity", "full"] = "none",
+    level_scheduling: Literal["asap", "alap"] = "asap",
+    cache_file: str = "",
+    timeout: int = 0,
+    memory_limit: int = 0,
+    resource_limit: int = 0,
+    cancel: CancellationToken | None = None,
+    trace_file: str = "",
 ) -> dict[str, Any]: ...
+def check_equivalence_batch(
+    pairs: list[tuple[QuantumComputation, QuantumComputation]],
+    inputs: list[list[str]] = ...,
+    timeout: int = 0,
+    threads: int = 0,
+    backend: Literal["z3", "cdcl"] = "z3",
+    encoding: Literal["binary", "onehot", "order"] = "binary",
+    check: Literal["miter", "direct", "unitary"] = "miter",
+    cross_check: bool = False,
+    level_compression: Literal["none", "identity", "full"] = "none",
+    level_scheduling: Literal["asap", "alap"] = "asap",
+    cache_file: str = "",
+    memory_limit: int = 0,
+    resource_limit: int = 0,
+    cancel: CancellationToken | None = None,
+) -> list[dict[str, Any]]: ...
 def generate_dimacs(
     circ: QuantumComputation,
 ) -> str: ...
+def write_dimacs(
+    circ: QuantumComputation,
+    file: str | int,
+    gzip: bool = False,
+    encoding: Literal["binary", "onehot", "order"] = "binary",
+) -> None: ...
@@ -8,6 +8,11 @@
  * Licensed under the MIT License
  */
 
+#include "CancellationToken.hpp"
+#include "Configuration.hpp"
+#include "DimacsWriter.hpp"
+#include "EquivalenceBatch.hpp"
+#include "SatBackend.hpp"
 #include "SatEncoder.hpp"
 
 #include <pybind11/pybind11.h>
@@ -18,36 +23,218 @@ namespace py = pybind11;
 namespace nl = nlohmann;
 using namespace pybind11::literals;
 
-nl::basic_json<> checkEquivalence(qc::QuantumComputation&         qc1,
-                                  qc::QuantumComputation&         qc2,
-                                  const std::vector<std::string>& inputs = {}) {
+nl::basic_json<> checkEquivalence(
+    qc::QuantumComputation& qc1, qc::QuantumComputation& qc2,
+    const std::vector<std::string>& inputs = {},
+    const std::string& backend = "z3", const std::string& encoding = "binary",
+    const std::string& check = "miter", const bool crossCheck = false,
+    const std::string& levelCompression = "none",
+    const std::string& levelScheduling = "asap",
+    const std::string& cacheFile = "", const std::size_t timeout = 0U,
+    const std::size_t memoryLimit = 0U, const std::size_t resourceLimit = 0U,
+    const CancellationToken* cancel    = nullptr,
+    const std::string&       traceFile = "") {
   nl::basic_json results{};
-  SatEncoder     encoder{};
-  try {
-    results["equivalent"] = encoder.testEqual(qc1, qc2, inputs);
-  } catch (std::exception const& e) {
-    py::print("Could not check equivalence: ", e.what());
+  Configuration  configuration{};
+  configuration.backend          = satBackendFromString(backend);
+  configuration.encoding         = encodingFromString(encoding);
+  configuration.equivalenceCheck = equivalenceCheckFromString(check);
+  configuration.crossCheck       = crossCheck;
+  configuration.levelCompression = levelCompressionFromString(levelCompression);
+  configuration.levelScheduling  = levelSchedulingFromString(levelScheduling);
+  configuration.cacheFile        = cacheFile;
+  configuration.timeout          = timeout;
+  configuration.memoryLimit      = memoryLimit;
+  configuration.resourceLimit    = resourceLimit;
+  configuration.trace            = !traceFile.empty();
+  SatEncoder encoder(configuration);
+  if (cancel != nullptr) {
+    encoder.setCancellationToken(*cancel);
+  }
+  bool        equivalent = false;
+  std::string error;
+  {
+    // the GIL is released, so the check can be cancelled from Python
+    const py::gil_scoped_release release;
+    try {
+      equivalent = encoder.testEqual(qc1, qc2, inputs);
+    } catch (std::exception const& e) {
+      error = e.what();
+    }
+  }
+  if (!error.empty()) {
+    py::print("Could not check equivalence: ", error);
     return {};
   }
-  results["statistics"] = encoder.getStats().to_json();
+  const auto& stats = encoder.getStats();
+  if (configuration.trace) {
+    stats.profile.writeChromeTrace(traceFile);
+  }
+  // an interrupted check has no verdict
+  results["equivalent"] =
+      stats.decided() ? nl::basic_json<>(equivalent) : nl::basic_json<>();
+  results["statistics"] = stats.to_json();
   return results;
 }
 
+nl::basic_json<> checkEquivalenceBatch(
+    const std::vector<
+        std::pair<qc::QuantumComputation*, qc::QuantumComputation*>>& pairs,
+    const std::vector<std::vector<std::string>>& inputs = {},
+    const std::size_t timeout = 0U, const std::size_t threads = 0U,
+    const std::string& backend = "z3", const std::string& encoding = "binary",
+    const std::string& check = "miter", const bool crossCheck = false,
+    const std::string& levelCompression = "none",
+    const std::string& levelScheduling  = "asap",
+    const std::string& cacheFile = "", const std::size_t memoryLimit = 0U,
+    const std::size_t        resourceLimit = 0U,
+    const CancellationToken* cancel        = nullptr) {
+  if (!inputs.empty() && inputs.size() != pairs.size()) {
+    throw std::invalid_argument("Expected one list of inputs per pair");
+  }
+  Configuration configuration{};
+  configuration.nThreads         = threads;
+  configuration.backend          = satBackendFromString(backend);
+  configuration.encoding         = encodingFromString(encoding);
+  configuration.equivalenceCheck = equivalenceCheckFromString(check);
+  configuration.crossCheck       = crossCheck;
+  configuration.levelCompression = levelCompressionFromString(levelCompression);
+  configuration.levelScheduling  = levelSchedulingFromString(levelScheduling);
+  configuration.cacheFile        = cacheFile;
+  configuration.timeout          = timeout;
+  configuration.memoryLimit      = memoryLimit;
+  configuration.resourceLimit    = resourceLimit;
+
+  std::vector<EquivalenceJob> jobs(pairs.size());
+  for (std::size_t j = 0U; j < pairs.size(); j++) {
+    jobs[j].circuitOne = pairs[j].first;
+    jobs[j].circuitTwo = pairs[j].second;
+    if (!inputs.empty()) {
+      jobs[j].inputs = inputs[j];
+    }
+  }
+  std::vector<EquivalenceResult> results;
+  {
+    // the circuits are only read, Python threads may run meanwhile
+    const py::gil_scoped_release release;
+    EquivalenceBatch             batch(configuration);
+    if (cancel != nullptr) {
+      batch.setCancellationToken(*cancel);
+    }
+    results = batch.run(jobs);
+  }
+
+  auto list = nl::basic_json<>::array();
+  for (const auto& result : results) {
+    if (!result.error.empty()) {
+      list.push_back({{"error", result.error}});
+      continue;
+    }
+    list.push_back({{"equivalent", result.stats.decided()
+                                       ? nl::basic_json<>(result.equivalent)
+                                       : nl::basic_json<>()},
+                    {"statistics", result.stats.to_json()}});
+  }
+  return list;
+}
+
 std::string printDIMACS(qc::QuantumComputation& qc) {
   SatEncoder encoder{};
   return encoder.generateDIMACS(qc);
 }
 
+template <class File>
+void writeDIMACS(qc::QuantumComputation& qc, const File& file,
+                 const bool gzip, const std::string& encoding) {
+  Configuration configuration{};
+  configuration.encoding = encodingFromString(encoding);
+  const py::gil_scoped_release release;
+  SatEncoder                   encoder(configuration);
+  DimacsWriter                 writer(file, gzip);
+  encoder.writeDIMACS(qc, writer);
+}
+
 PYBIND11_MODULE(pyqusat, m) {
   m.doc() =
       "Python interface for the MQT QuSAT quantum circuit satisfiability tool";
 
+  py::class_<CancellationToken>(
+      m, "CancellationToken",
+      "Cancels the checks it is passed to, e.g., from another thread. "
+      "Cancelled checks return None as their verdict.")
+      .def(py::init<>())
+      .def("cancel", &CancellationToken::cancel,
+           "Requests the cancellation of all checks that use the token.")
+      .def("cancelled", &CancellationToken::cancelled,
+           "Whether the token has been cancelled.");
+
   m.def("check_equivalence", &checkEquivalence,
         "Check the equivalence of two clifford circuits for the given inputs."
-        "If no inputs are given, the all zero state is used as input.",
-        "circ1"_a, "circ2"_a, "inputs"_a = std::vector<std::string>());
+        "If no inputs are given, the all zero state is used as input. The "
+        "backend selects the SAT solver ('z3' or 'cdcl'), encoding the "
+        "encoding of the generator variables ('binary', 'onehot' or "
+        "'order'). check selects whether equivalence is decided by the SAT "
+        "miter ('miter'), by comparing the output states directly ('direct') "
+        "or as operators independent of the inputs ('unitary'). cross_check "
+        "validates the unitary check with the SAT miter. level_compression "
+        "composes the generator mappings of consecutive levels before they "
+        "are encoded: 'none' keeps every level, 'identity' drops levels that "
+        "change no generator and 'full' keeps only input and output. "
+        "level_scheduling places every gate in the first ('asap') or last "
+        "('alap') level it can be placed in, gates that are diagonal on the "
+        "qubits they share commute. "
+        "cache_file names a file in which simulated circuits are stored and "
+        "from which they are replayed in later checks. timeout limits the "
+        "check to the given number of milliseconds, memory_limit the memory "
+        "of the simulation and of the solver to the given number of "
+        "megabytes and resource_limit the deterministic work of the solver "
+        "(z3's rlimit or the propagations of the CDCL solver), 0 for no "
+        "limit. cancel takes a CancellationToken that cancels the check. The "
+        "GIL is released during the check. A check that reaches a limit or "
+        "is cancelled has None as its verdict and reports why in the "
+        "'interruption' of its statistics. The 'profile' of the statistics "
+        "holds the nanosecond times of the phases of the check and counters "
+        "of its hot paths. trace_file names a file the timed phases are "
+        "written to in the Chrome trace event format.",
+        "circ1"_a, "circ2"_a, "inputs"_a = std::vector<std::string>(),
+        "backend"_a = "z3", "encoding"_a = "binary", "check"_a = "miter",
+        "cross_check"_a = false, "level_compression"_a = "none",
+        "level_scheduling"_a = "asap", "cache_file"_a = "", "timeout"_a = 0U,
+        "memory_limit"_a = 0U, "resource_limit"_a = 0U, "cancel"_a = nullptr,
+        "trace_file"_a = "");
+
+  m.def("check_equivalence_batch", &checkEquivalenceBatch,
+        "Check the equivalence of many pairs of clifford circuits on a pool "
+        "of threads, without holding the GIL. inputs holds one list of input "
+        "states per pair, or is empty to use the all zero state for all "
+        "pairs. Every circuit is simulated once per list of inputs, even if "
+        "it occurs in several pairs. timeout limits every check to the given "
+        "number of milliseconds (0 for no limit) and threads sets the number "
+        "of threads (0 for one per hardware thread). backend, encoding, "
+        "check, cross_check, level_compression, level_scheduling, "
+        "cache_file, memory_limit, resource_limit and cancel apply to every "
+        "pair as in check_equivalence, the phases of a batch cannot be "
+        "traced. Returns one result per pair, in order, which holds an error "
+        "message instead of a verdict if the pair could not be checked.",
+        "pairs"_a, "inputs"_a = std::vector<std::vector<std::string>>(),
+        "timeout"_a = 0U, "threads"_a = 0U, "backend"_a = "z3",
+        "encoding"_a = "binary", "check"_a = "miter", "cross_check"_a = false,
+        "level_compression"_a = "none", "level_scheduling"_a = "asap",
+        "cache_file"_a = "", "memory_limit"_a = 0U, "resource_limit"_a = 0U,
+        "cancel"_a = nullptr);
 
   m.def("generate_dimacs", &printDIMACS,
-        "Output the DIMACS CNF representation from Z3 of the given circuit.",
+        "Output the DIMACS CNF representation of the given circuit.",
         "circ"_a);
+
+  m.def("write_dimacs", &writeDIMACS<std::string>,
+        "Write the DIMACS CNF representation of the given circuit to a file "
+        "while it is built, optionally gzip-compressed, without holding the "
+        "GIL. Comment lines list the variables of every level and the "
+        "generators of the input and output.",
+        "circ"_a, "file"_a, "gzip"_a = false, "encoding"_a = "binary");
+  m.def("write_dimacs", &writeDIMACS<int>,
+        "Write the DIMACS CNF representation of the given circuit to a file "
+        "descriptor, e.g., a pipe to a solver, which is not closed.",
+        "circ"_a, "file"_a, "gzip"_a = false, "encoding"_a = "binary");
 }
@@ -10,11 +10,16 @@
 
 from __future__ import annotations
 
+from typing import TYPE_CHECKING
+
 from qiskit.circuit import QuantumCircuit
 
 from mqt.core import load
 from mqt.core.ir import QuantumComputation
-from mqt.qusat import check_equivalence
+from mqt.qusat import CancellationToken, check_equivalence, check_equivalence_batch, generate_dimacs, write_dimacs
+
+if TYPE_CHECKING:
+    from pathlib import Path
 
 
 def test_equivalence() -> None:
@@ -61,3 +66,234 @@ def test_equivalence_qiskit() -> None:
 
     result = check_equivalence(load(qc1), load(qc2))
     assert result["equivalent"]
+
+
+def test_equivalence_cdcl_backend() -> None:
+    """The in-process CDCL backend agrees with z3."""
+    qc1 = QuantumComputation(2)
+    qc1.cx(0, 1)
+
+    qc2 = QuantumComputation(2)
+    qc2.h(0)
+    qc2.h(1)
+    qc2.cx(1, 0)
+    qc2.h(1)
+    qc2.h(0)
+
+    result = check_equivalence(qc1, qc2, backend="cdcl")
+    assert result["equivalent"]
+    assert result["statistics"]["satBackend"] == "cdcl"
+
+    qc3 = QuantumComputation(2)
+    qc3.cx(1, 0)
+    result = check_equivalence(qc1, qc3, backend="cdcl")
+    assert not result["equivalent"]
+
+
+def test_equivalence_generator_encodings() -> None:
+    """All encodings of the generator variables yield the same verdict."""
+    qc1 = QuantumComputation(2)
+    qc1.cx(0, 1)
+
+    qc2 = QuantumComputation(2)
+    qc2.h(0)
+    qc2.h(1)
+    qc2.cx(1, 0)
+    qc2.h(1)
+    qc2.h(0)
+
+    qc3 = QuantumComputation(2)
+    qc3.cx(1, 0)
+
+    for encoding in ("binary", "onehot", "order"):
+        result = check_equivalence(qc1, qc2, encoding=encoding)
+        assert result["equivalent"]
+        assert not check_equivalence(qc1, qc3, encoding=encoding)["equivalent"]
+
+
+def test_equivalence_direct_check() -> None:
+    """The direct check compares the output states without a SAT instance."""
+    qc1 = QuantumComputation(2)
+    qc1.cx(0, 1)
+    qc1.h(0)
+
+    qc2 = QuantumComputation(2)
+    qc2.h(0)
+
+    result = check_equivalence(qc1, qc2, check="direct")
+    assert result["equivalent"]
+    assert result["statistics"]["equivalenceCheck"] == "direct"
+    assert not check_equivalence(qc1, qc2, inputs=["ZI"], check="direct")["equivalent"]
+
+
+def test_equivalence_unitary_check() -> None:
+    """The unitary check compares the circuits as operators."""
+    qc1 = QuantumComputation(2)
+    qc1.cx(0, 1)
+    qc1.h(0)
+
+    qc2 = QuantumComputation(2)
+    qc2.h(0)
+
+    assert check_equivalence(qc1, qc2, check="direct")["equivalent"]
+    result = check_equivalence(qc1, qc2, check="unitary", cross_check=True)
+    assert not result["equivalent"]
+    assert result["statistics"]["equivalenceCheck"] == "unitary"
+
+
+def test_equivalence_counterexample() -> None:
+    """A failed check reports the input that distinguishes the circuits."""
+    qc1 = QuantumComputation(3)
+    qc1.h(0)
+
+    qc2 = QuantumComputation(3)
+    qc2.h(0)
+    qc2.z(2)
+
+    result = check_equivalence(qc1, qc2, inputs=["ZZZ", "xZZ", "ZZx"])
+    assert not result["equivalent"]
+    counterexample = result["statistics"]["counterexample"]
+    assert counterexample["input"] == 2
+    assert counterexample["state"] == "ZZx"
+    assert counterexample["level"] == 0
+
+
+def test_equivalence_level_compression() -> None:
+    """Compressed levels need fewer variables, but keep the verdict."""
+    qc1 = QuantumComputation(1)
+    qc1.z(0)
+    qc1.h(0)
+    qc1.z(0)
+
+    qc2 = QuantumComputation(1)
+    qc2.h(0)
+    qc2.z(0)
+
+    variables = {}
+    for compression in ("none", "identity", "full"):
+        result = check_equivalence(qc1, qc2, level_compression=compression)
+        assert result["equivalent"]
+        variables[compression] = result["statistics"]["numSatVarsCreated"]
+    assert variables["full"] < variables["identity"] < variables["none"]
+
+
+def test_equivalence_level_scheduling() -> None:
+    """Diagonal gates commute into earlier levels, but keep the verdict."""
+    qc1 = QuantumComputation(2)
+    qc1.x(1)
+    qc1.cx(0, 1)
+    qc1.s(0)
+
+    qc2 = QuantumComputation(2)
+    qc2.s(0)
+    qc2.x(1)
+    qc2.cx(0, 1)
+
+    for scheduling in ("asap", "alap"):
+        result = check_equivalence(qc1, qc2, level_scheduling=scheduling)
+        assert result["equivalent"]
+        assert result["statistics"]["circDepth"] == 2
+
+
+def test_equivalence_cache_file(tmp_path: Path) -> None:
+    """A second check of the same circuits replays them from the cache."""
+    qc1 = QuantumComputation(2)
+    qc1.h(0)
+    qc1.cx(0, 1)
+
+    qc2 = QuantumComputation(2)
+    qc2.h(0)
+    qc2.cx(0, 1)
+    qc2.z(1)
+
+    cache_file = str(tmp_path / "generators.cache")
+    first = check_equivalence(qc1, qc2, inputs=["ZZ", "xZ"], cache_file=cache_file)
+    second = check_equivalence(qc1, qc2, inputs=["ZZ", "xZ"], cache_file=cache_file)
+    assert first["equivalent"] == second["equivalent"]
+    assert first["statistics"]["numCachedLevels"] == 0
+    assert second["statistics"]["numCachedLevels"] > 0
+
+
+def test_equivalence_batch() -> None:
+    """A batch returns one result per pair, in order."""
+    qc1 = QuantumComputation(2)
+    qc1.h(0)
+    qc1.cx(0, 1)
+
+    qc2 = QuantumComputation(2)
+    qc2.h(0)
+    qc2.cx(0, 1)
+    qc2.z(1)
+
+    qc3 = QuantumComputation(2)
+    qc3.t(0)
+
+    pairs = [(qc1, qc1), (qc1, qc2), (qc2, qc3)]
+    results = check_equivalence_batch(pairs, inputs=[["ZZ"], ["ZZ", "xZ"], []], threads=2)
+    assert len(results) == len(pairs)
+    assert results[0]["equivalent"]
+    assert results[1]["equivalent"] == check_equivalence(qc1, qc2, inputs=["ZZ", "xZ"])["equivalent"]
+    assert results[1]["statistics"]["numInputs"] == 2
+    assert "error" in results[2]
+
+
+def test_equivalence_batch_options(tmp_path: Path) -> None:
+    """A batch takes the cross check and the cache file of single checks."""
+    qc1 = QuantumComputation(2)
+    qc1.h(0)
+    qc1.cx(0, 1)
+
+    qc2 = QuantumComputation(2)
+    qc2.h(0)
+    qc2.cx(0, 1)
+    qc2.z(1)
+
+    pairs = [(qc1, qc1), (qc1, qc2)]
+    results = check_equivalence_batch(pairs, check="unitary", cross_check=True)
+    assert results[0]["equivalent"]
+    assert not results[1]["equivalent"]
+
+    cache_file = str(tmp_path / "generators.cache")
+    first = check_equivalence_batch(pairs, inputs=[["ZZ"], ["ZZ"]], cache_file=cache_file)
+    second = check_equivalence_batch(pairs, inputs=[["ZZ"], ["ZZ"]], cache_file=cache_file)
+    assert [r["equivalent"] for r in first] == [r["equivalent"] for r in second]
+    assert first[0]["statistics"]["numCachedLevels"] == 0
+    assert second[0]["statistics"]["numCachedLevels"] > 0
+
+
+def test_equivalence_cancelled() -> None:
+    """A cancelled check has no verdict and reports the cancellation."""
+    qc1 = QuantumComputation(2)
+    qc1.h(0)
+    qc1.cx(0, 1)
+
+    token = CancellationToken()
+    token.cancel()
+    assert token.cancelled()
+    result = check_equivalence(qc1, qc1, cancel=token)
+    assert result["equivalent"] is None
+    assert result["statistics"]["interruption"] == "cancelled"
+
+    results = check_equivalence_batch([(qc1, qc1)], cancel=token)
+    assert results[0]["equivalent"] is None
+    assert check_equivalence(qc1, qc1, resource_limit=1000000)["equivalent"]
+
+
+def test_write_dimacs(tmp_path: Path) -> None:
+    """The streamed instance equals the generated one after its comment lines."""
+    qc = QuantumComputation(2)
+    qc.h(0)
+    qc.cx(0, 1)
+    qc.s(1)
+
+    path = tmp_path / "instance.cnf"
+    write_dimacs(qc, str(path))
+    lines = path.read_text(encoding="utf-8").splitlines(keepends=True)
+    comments = [line for line in lines if line.startswith("c ")]
+    assert comments
+    assert comments[0].startswith("c qusat instance")
+    assert "".join(lines[len(comments) :]) == generate_dimacs(qc)
+
+    with (tmp_path / "piped.cnf").open("wb") as file:
+        write_dimacs(qc, file.fileno())
+    assert (tmp_path / "piped.cnf").read_text(encoding="utf-8") == path.read_text(encoding="utf-8")
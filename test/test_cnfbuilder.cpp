@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "BinaryStream.hpp"
+#include "CnfBuilder.hpp"
+#include "DimacsWriter.hpp"
+#include "GeneratorEncoding.hpp"
+#include "SatBackend.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+// whether the assignment (bit v-1 holds the value of variable v) satisfies cnf
+bool satisfies(const CnfBuilder& cnf, const std::uint64_t assignment) {
+  bool result = true;
+  cnf.forEachClause([&](const CnfBuilder::Literal* first,
+                        const CnfBuilder::Literal* last) {
+    bool satisfied = false;
+    for (const auto* it = first; it != last; ++it) {
+      const auto value = ((assignment >> (std::abs(*it) - 1)) & 1U) != 0U;
+      satisfied |= (*it > 0) == value;
+    }
+    result &= satisfied;
+  });
+  return result;
+}
+
+// whether some assignment of the variables from `fixed` on extends assignment
+bool satisfiable(const CnfBuilder& cnf, const std::uint64_t assignment,
+                 const std::size_t fixed) {
+  const auto free = cnf.variables() - fixed;
+  for (std::uint64_t aux = 0U; aux < (1ULL << free); aux++) {
+    if (satisfies(cnf, assignment | (aux << fixed))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+std::string readFile(const std::string& path) {
+  std::ifstream stream(path, std::ios::binary);
+  return {std::istreambuf_iterator<char>(stream),
+          std::istreambuf_iterator<char>()};
+}
+} // namespace
+
+TEST(CnfBuilderTest, LessThanAdmitsExactlyTheSmallerNumbers) {
+  for (std::uint64_t bound = 0U; bound <= 17U; bound++) {
+    CnfBuilder cnf{};
+    const auto bits = cnf.newVariables(4U);
+    cnf.addLessThan(bits, bound);
+    for (std::uint64_t value = 0U; value < 16U; value++) {
+      EXPECT_EQ(satisfies(cnf, value), value < bound)
+          << value << " < " << bound;
+    }
+  }
+}
+
+TEST(CnfBuilderTest, ImplicationAndMiterConstraints) {
+  CnfBuilder cnf{};
+  const auto a = cnf.newVariables(3U);
+  const auto b = cnf.newVariables(3U);
+  // a = 5 -> b = 2
+  cnf.addImplication(CnfBuilder::equals(a, 5U), CnfBuilder::equals(b, 2U));
+  for (std::uint64_t x = 0U; x < 8U; x++) {
+    for (std::uint64_t y = 0U; y < 8U; y++) {
+      EXPECT_EQ(satisfies(cnf, x | (y << 3U)), x != 5U || y == 2U);
+    }
+  }
+
+  CnfBuilder equal{};
+  const auto c = equal.newVariables(2U);
+  const auto d = equal.newVariables(2U);
+  equal.addEqual(c, d);
+  CnfBuilder differ{};
+  const auto e = differ.newVariables(2U);
+  const auto f = differ.newVariables(2U);
+  differ.addNotEqual(e, f);
+  EXPECT_EQ(differ.variables(), 6U);
+  for (std::uint64_t x = 0U; x < 4U; x++) {
+    for (std::uint64_t y = 0U; y < 4U; y++) {
+      EXPECT_EQ(satisfies(equal, x | (y << 2U)), x == y);
+      // some choice of the auxiliary variables satisfies the miter output
+      bool any = false;
+      for (std::uint64_t aux = 0U; aux < 4U; aux++) {
+        any |= satisfies(differ, x | (y << 2U) | (aux << 4U));
+      }
+      EXPECT_EQ(any, x != y);
+    }
+  }
+}
+
+TEST(CnfBuilderTest, WritesDIMACS) {
+  CnfBuilder cnf{};
+  const auto x = cnf.newVariable();
+  const auto y = cnf.newVariable();
+  cnf.addClause({x, -y});
+  cnf.addClause({y});
+  EXPECT_EQ(cnf.clauses(), 2U);
+  EXPECT_EQ(cnf.toDIMACS(), "p cnf 2 2\n1 -2 0\n2 0\n");
+}
+
+TEST(CnfBuilderTest, StreamsDIMACSThroughWriter) {
+  // clauses of every kind, more than fit into the buffer of the writer
+  const auto build = [](CnfBuilder& cnf) {
+    const auto lits = cnf.newVariables(2000U);
+    cnf.addAtMostOne(lits);
+    cnf.addLessThan({lits[0], lits[1], lits[2]}, 5U);
+    cnf.addImplication({lits[3], -lits[4]}, {lits[5], lits[6]});
+    cnf.addClause({});
+  };
+  CnfBuilder reference{};
+  build(reference);
+  ASSERT_GT(reference.toDIMACS().size(), DimacsWriter::BUFFER_BYTES);
+
+  const auto path = ::testing::TempDir() + "qusat_stream.cnf";
+  {
+    DimacsWriter writer(path, false);
+    writer.comment("first\nsecond");
+    writer.problem(reference.variables(), reference.clauses());
+    CnfBuilder cnf{};
+    cnf.setSink(&writer);
+    build(cnf);
+    EXPECT_TRUE(cnf.literals().empty());
+    EXPECT_EQ(cnf.clauses(), reference.clauses());
+    writer.finish();
+    EXPECT_EQ(writer.clauses(), reference.clauses());
+  }
+  EXPECT_EQ(readFile(path), "c first\nc second\n" + reference.toDIMACS());
+
+  // the writer reports clauses that differ from the problem line
+  {
+    DimacsWriter writer(path, false);
+    writer.problem(2U, 2U);
+    const std::vector<CnfBuilder::Literal> clause{1, -2};
+    writer.addClause(clause.data(), clause.data() + clause.size());
+    EXPECT_THROW(writer.finish(), std::runtime_error);
+    EXPECT_THROW(writer.comment("late"), std::logic_error);
+  }
+
+  if (DimacsWriter::gzipSupported()) {
+    {
+      DimacsWriter writer(path, true);
+      writer.problem(reference.variables(), reference.clauses());
+      reference.forEachClause([&](const CnfBuilder::Literal* first,
+                                  const CnfBuilder::Literal* last) {
+        writer.addClause(first, last);
+      });
+      writer.finish();
+    }
+    const auto compressed = readFile(path);
+    ASSERT_GT(compressed.size(), 2U);
+    EXPECT_EQ(static_cast<unsigned char>(compressed[0]), 0x1fU);
+    EXPECT_EQ(static_cast<unsigned char>(compressed[1]), 0x8bU);
+    EXPECT_LT(compressed.size(), reference.toDIMACS().size());
+  } else {
+    EXPECT_THROW(DimacsWriter(path, true), std::runtime_error);
+  }
+  std::remove(path.c_str());
+}
+
+TEST(CnfBuilderTest, BinaryRoundTripAcrossChunks) {
+  // more literals than fit into one chunk, and an odd number of them
+  CnfBuilder cnf{};
+  const auto lits = cnf.newVariables(3000U);
+  cnf.addAtMostOne(lits);
+  cnf.addClause({lits.front(), -lits.back()});
+  ASSERT_GT(cnf.literals().size(), 2U * BinaryWriter::CHUNK_WORDS);
+  ASSERT_EQ(cnf.literals().size() % 2U, 1U);
+
+  std::stringstream stream;
+  cnf.writeBinary(stream);
+  const auto bytes = stream.str();
+  const auto read  = CnfBuilder::readBinary(stream);
+  EXPECT_EQ(read.variables(), cnf.variables());
+  EXPECT_EQ(read.clauses(), cnf.clauses());
+  EXPECT_EQ(read.literals(), cnf.literals());
+  EXPECT_EQ(read.toDIMACS(), cnf.toDIMACS());
+
+  // a flipped bit, a truncated file and another version are rejected
+  const auto rejects = [](const std::string& contents) {
+    std::istringstream in(contents);
+    EXPECT_THROW(static_cast<void>(CnfBuilder::readBinary(in)),
+                 std::runtime_error);
+  };
+  auto flipped = bytes;
+  flipped[bytes.size() / 2U] ^= 0x10;
+  rejects(flipped);
+  rejects(bytes.substr(0U, bytes.size() - 8U));
+  rejects(bytes.substr(0U, 20U));
+  auto version = bytes;
+  version[8U]++;
+  rejects(version);
+
+  // the empty instance
+  std::stringstream empty;
+  CnfBuilder{}.writeBinary(empty);
+  EXPECT_EQ(CnfBuilder::readBinary(empty).clauses(), 0U);
+}
+
+TEST(CnfBuilderTest, AtMostOneForPairwiseAndSequentialEncodings) {
+  for (std::size_t n = 1U; n <= 7U; n++) {
+    CnfBuilder cnf{};
+    const auto lits = cnf.newVariables(n);
+    cnf.addAtMostOne(lits);
+    for (std::uint64_t x = 0U; x < (1ULL << n); x++) {
+      std::size_t ones = 0U;
+      for (std::size_t i = 0U; i < n; i++) {
+        ones += (x >> i) & 1U;
+      }
+      EXPECT_EQ(satisfiable(cnf, x, n), ones <= 1U)
+          << n << " literals, assignment " << x;
+    }
+  }
+}
+
+TEST(GeneratorEncodingTest, LevelsHoldExactlyTheGeneratorIds) {
+  for (const auto type :
+       {EncodingType::Binary, EncodingType::OneHot, EncodingType::Order}) {
+    for (std::size_t generators = 1U; generators <= 6U; generators++) {
+      const GeneratorEncoding encoding(type, generators);
+      CnfBuilder              cnf{};
+      const auto              level = encoding.newLevel(cnf);
+      const auto              width = cnf.variables();
+      // every model of the domain constraints holds exactly one id
+      for (std::uint64_t x = 0U; x < (1ULL << width); x++) {
+        std::size_t matches = 0U;
+        for (std::size_t id = 0U; id < generators; id++) {
+          CnfBuilder assignment = cnf;
+          for (const auto lit : encoding.equals(level, id)) {
+            assignment.addClause({lit});
+          }
+          matches += satisfies(assignment, x) ? 1U : 0U;
+        }
+        EXPECT_EQ(matches, satisfies(cnf, x) ? 1U : 0U)
+            << toString(type) << " with " << generators << " generators";
+      }
+    }
+  }
+}
+
+TEST(GeneratorEncodingTest, MiterConstraints) {
+  const std::size_t generators = 5U;
+  // whether cnf has a model in which lhs holds id a and rhs holds id b
+  const auto holds = [](const CnfBuilder&              cnf,
+                        const std::vector<CnfBuilder::Literal>& assumptions) {
+    auto solver = SatBackend::create(SatBackendType::CDCL);
+    solver->addCnf(cnf);
+    for (const auto lit : assumptions) {
+      solver->assume(lit);
+    }
+    return solver->solve() == SatResult::Satisfiable;
+  };
+  for (const auto type :
+       {EncodingType::Binary, EncodingType::OneHot, EncodingType::Order}) {
+    const GeneratorEncoding encoding(type, generators);
+    for (std::size_t bound = 0U; bound <= generators; bound++) {
+      CnfBuilder equal{};
+      const auto lhs    = encoding.newLevel(equal);
+      const auto rhs    = encoding.newLevel(equal);
+      CnfBuilder differ = equal;
+      encoding.addEqual(equal, lhs, rhs);
+      encoding.addLessThan(equal, lhs, bound);
+      encoding.addNotEqual(differ, lhs, rhs);
+      for (std::size_t a = 0U; a < generators; a++) {
+        for (std::size_t b = 0U; b < generators; b++) {
+          auto assumptions = encoding.equals(lhs, a);
+          for (const auto lit : encoding.equals(rhs, b)) {
+            assumptions.emplace_back(lit);
+          }
+          EXPECT_EQ(holds(equal, assumptions), a == b && a < bound)
+              << toString(type) << ": " << a << ", " << b << " < " << bound;
+          EXPECT_EQ(holds(differ, assumptions), a != b)
+              << toString(type) << ": " << a << ", " << b;
+        }
+      }
+    }
+  }
+}
+
+TEST(GeneratorEncodingTest, EncodingsAreNamed) {
+  EXPECT_EQ(encodingFromString(toString(EncodingType::Order)),
+            EncodingType::Order);
+  EXPECT_THROW(static_cast<void>(encodingFromString("gray")),
+               std::invalid_argument);
+}
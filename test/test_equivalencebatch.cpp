@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CancellationToken.hpp"
+#include "Configuration.hpp"
+#include "EquivalenceBatch.hpp"
+#include "SatBackend.hpp"
+#include "SatEncoder.hpp"
+#include "algorithms/RandomCliffordCircuit.hpp"
+#include "circuit_optimizer/CircuitOptimizer.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(EquivalenceBatchTest, AgreesWithSeparateChecks) {
+  std::mt19937 gen(67U);
+  auto         circOne = qc::createRandomCliffordCircuit(4, 15, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  auto circTwo = circOne;
+  circTwo.h(2);
+  circTwo.h(2);
+  auto circThree = circOne;
+  circThree.z(1);
+  auto circFour = qc::createRandomCliffordCircuit(4, 10, gen());
+  qc::CircuitOptimizer::flattenOperations(circFour);
+
+  const std::vector<std::string> inputs{"ZZZZ", "xZZZ", "ZxyZ"};
+  const std::vector<std::string> others{"ZZxZ", "ZyZZ"};
+  const std::vector<EquivalenceJob> jobs{
+      {&circOne, &circTwo, inputs},   {&circOne, &circThree, inputs},
+      {&circTwo, &circThree, others}, {&circThree, &circFour, {}},
+      {&circOne, &circOne, others},   {&circFour, &circTwo, inputs}};
+
+  Configuration direct{};
+  direct.equivalenceCheck = EquivalenceCheck::Direct;
+  Configuration unitary{};
+  unitary.equivalenceCheck = EquivalenceCheck::Unitary;
+  Configuration serial{};
+  serial.nThreads = 1U;
+  for (const auto& config : {Configuration{}, direct, unitary, serial}) {
+    EquivalenceBatch batch(config);
+    const auto       results = batch.run(jobs);
+    ASSERT_EQ(results.size(), jobs.size());
+    for (std::size_t j = 0U; j < jobs.size(); j++) {
+      SatEncoder separate(config);
+      const auto expected =
+          separate.testEqual(*jobs[j].circuitOne, *jobs[j].circuitTwo,
+                             jobs[j].inputs);
+      const auto& stats = results[j].stats;
+      EXPECT_TRUE(results[j].error.empty()) << results[j].error;
+      EXPECT_EQ(results[j].equivalent, expected) << "job " << j;
+      EXPECT_EQ(stats.counterexample.found,
+                separate.getStats().counterexample.found);
+      EXPECT_EQ(stats.nrOfGenerators, separate.getStats().nrOfGenerators);
+      EXPECT_EQ(stats.nrOfSatVars, separate.getStats().nrOfSatVars);
+      EXPECT_EQ(stats.circuitDepth, separate.getStats().circuitDepth);
+    }
+  }
+}
+
+TEST(EquivalenceBatchTest, ReportsJobsThatCannotBeChecked) {
+  auto clifford = qc::QuantumComputation(2);
+  clifford.h(0);
+  clifford.cx(0, 1);
+  auto nonClifford = qc::QuantumComputation(2);
+  nonClifford.t(0);
+  auto empty = qc::QuantumComputation(2);
+
+  EquivalenceBatch batch{};
+  const auto       results =
+      batch.run({{&clifford, &nonClifford, {}},
+                 {&clifford, &clifford, {"ZZ", "xZ"}},
+                 {&empty, &clifford, {}},
+                 {&clifford, nullptr, {}}});
+  ASSERT_EQ(results.size(), 4U);
+  EXPECT_EQ(results[0].error, "Circuits are not Clifford circuits");
+  EXPECT_TRUE(results[1].error.empty());
+  EXPECT_TRUE(results[1].equivalent);
+  EXPECT_EQ(results[1].stats.nrOfDiffInputStates, 2U);
+  EXPECT_EQ(results[2].error, "Both circuits must be non-empty");
+  EXPECT_EQ(results[3].error, "Job without circuit");
+  EXPECT_TRUE(batch.run({}).empty());
+}
+
+TEST(EquivalenceBatchTest, CancelledJobsHaveNoVerdict) {
+  auto circuit = qc::QuantumComputation(2);
+  circuit.h(0);
+  circuit.cx(0, 1);
+
+  EquivalenceBatch        batch{};
+  const CancellationToken token{};
+  token.cancel();
+  batch.setCancellationToken(token);
+  const auto results =
+      batch.run({{&circuit, &circuit, {}}, {&circuit, &circuit, {"ZZ"}}});
+  ASSERT_EQ(results.size(), 2U);
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.error.empty());
+    EXPECT_FALSE(result.equivalent);
+    EXPECT_EQ(result.stats.interruption, Interruption::Cancelled);
+  }
+}
+
+TEST(EquivalenceBatchTest, TimeLimitsBoundTheSharedSimulation) {
+  std::mt19937 gen(71U);
+  auto         large = qc::createRandomCliffordCircuit(40, 400, gen());
+  qc::CircuitOptimizer::flattenOperations(large);
+  std::vector<std::string> inputs;
+  for (std::size_t i = 0U; i < 30U; i++) {
+    std::string input(40U, 'Z');
+    input[i] = 'x';
+    inputs.emplace_back(input);
+  }
+  auto small = qc::QuantumComputation(2);
+  small.h(0);
+  small.cx(0, 1);
+
+  // the simulation of the large circuit takes far longer than a millisecond
+  EquivalenceBatch batch{};
+  auto             results =
+      batch.run({{&large, &large, inputs, 1U}, {&small, &small, {"ZZ"}}});
+  ASSERT_EQ(results.size(), 2U);
+  EXPECT_TRUE(results[0].error.empty());
+  EXPECT_FALSE(results[0].equivalent);
+  EXPECT_EQ(results[0].stats.interruption, Interruption::Timeout);
+  EXPECT_TRUE(results[1].equivalent);
+
+  // a job without a limit keeps the simulation of its group going
+  results = batch.run({{&large, &large, inputs, 1U}, {&large, &large, inputs}});
+  ASSERT_EQ(results.size(), 2U);
+  EXPECT_EQ(results[0].stats.interruption, Interruption::Timeout);
+  EXPECT_TRUE(results[1].equivalent);
+  EXPECT_EQ(results[1].stats.interruption, Interruption::None);
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "EquivalenceSession.hpp"
+#include "SatBackend.hpp"
+#include "SatEncoder.hpp"
+#include "algorithms/RandomCliffordCircuit.hpp"
+#include "circuit_optimizer/CircuitOptimizer.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(EquivalenceSessionTest, QueriesSelectInputs) {
+  // Z on qubit 2 only changes inputs with a superposition on qubit 2
+  auto circOne = qc::QuantumComputation(3);
+  circOne.h(0);
+  auto circTwo = qc::QuantumComputation(3);
+  circTwo.h(0);
+  circTwo.z(2);
+
+  EquivalenceSession session(circOne, circTwo, {"ZZZ", "xZZ", "ZZx", "ZZy"});
+  EXPECT_EQ(session.nrOfInputs(), 4U);
+  EXPECT_TRUE(session.testEqual(std::vector<std::size_t>{0U, 1U}));
+  EXPECT_FALSE(session.getStats().counterexample.found);
+  EXPECT_FALSE(session.testEqual(std::vector<std::size_t>{2U}));
+  EXPECT_EQ(session.getStats().counterexample.input, 2U);
+  EXPECT_FALSE(session.testEqual(std::vector<std::size_t>{0U, 3U}));
+  EXPECT_EQ(session.getStats().counterexample.state, "ZZy");
+  EXPECT_TRUE(session.testEqual(std::vector<std::string>{"xZZ"}));
+  EXPECT_FALSE(session.testEqual());
+  EXPECT_TRUE(session.testEqual(std::vector<std::size_t>{}));
+  EXPECT_THROW(session.testEqual(std::vector<std::string>{"ZZX"}),
+               std::invalid_argument);
+
+  // the all-zero state is the only candidate by default
+  EquivalenceSession zero(circOne, circTwo, {});
+  EXPECT_EQ(zero.nrOfInputs(), 1U);
+  EXPECT_TRUE(zero.testEqual());
+}
+
+TEST(EquivalenceSessionTest, AgreesWithSeparateChecks) {
+  std::mt19937                       gen(47U);
+  const std::string                  alphabet = "IZxXyY";
+  std::uniform_int_distribution<int> letter(0, 5);
+  std::vector<std::string>           inputs;
+  for (std::size_t i = 0U; i < 12U; i++) {
+    std::string input;
+    for (std::size_t q = 0U; q < 4U; q++) {
+      input += alphabet[static_cast<std::size_t>(letter(gen))];
+    }
+    inputs.emplace_back(input);
+  }
+
+  for (const auto backend : {SatBackendType::Z3, SatBackendType::CDCL}) {
+    Configuration config{};
+    config.backend = backend;
+    for (std::size_t run = 0U; run < 4U; run++) {
+      auto circOne = qc::createRandomCliffordCircuit(4, 6, gen());
+      qc::CircuitOptimizer::flattenOperations(circOne);
+      auto circTwo = circOne;
+      circTwo.erase(circTwo.begin() +
+                    static_cast<int>(gen() % circTwo.size()));
+
+      EquivalenceSession session(circOne, circTwo, inputs, config);
+      for (std::size_t query = 0U; query < 8U; query++) {
+        // random subset of the inputs
+        std::vector<std::size_t> indices;
+        std::vector<std::string> subset;
+        for (std::size_t i = 0U; i < inputs.size(); i++) {
+          if (gen() % 3U == 0U) {
+            indices.emplace_back(i);
+            subset.emplace_back(inputs[i]);
+          }
+        }
+        if (subset.empty()) {
+          continue;
+        }
+        SatEncoder separate(config);
+        EXPECT_EQ(session.testEqual(indices),
+                  separate.testEqual(circOne, circTwo, subset));
+        if (session.getStats().counterexample.found) {
+          // the reported input distinguishes the circuits on its own
+          SatEncoder single(config);
+          EXPECT_FALSE(single.testEqual(
+              circOne, circTwo, {session.getStats().counterexample.state}));
+        }
+      }
+    }
+  }
+}
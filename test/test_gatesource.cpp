@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "GateSource.hpp"
+#include "SatEncoder.hpp"
+#include "Tableau.hpp"
+#include "algorithms/RandomCliffordCircuit.hpp"
+#include "circuit_optimizer/CircuitOptimizer.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <optional>
+#include <random>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+void apply(Tableau& tableau, const CliffordGate& gate) {
+  switch (gate.type) {
+  case qc::OpType::H:
+    tableau.applyH(gate.target);
+    break;
+  case qc::OpType::S:
+    tableau.applyS(gate.target);
+    break;
+  case qc::OpType::Sdg:
+    tableau.applySdg(gate.target);
+    break;
+  case qc::OpType::X:
+    if (gate.controlled) {
+      tableau.applyCNOT(gate.control, gate.target);
+    } else {
+      tableau.applyX(gate.target);
+    }
+    break;
+  case qc::OpType::Y:
+    tableau.applyY(gate.target);
+    break;
+  case qc::OpType::Z:
+    tableau.applyZ(gate.target);
+    break;
+  default:
+    break;
+  }
+}
+
+std::vector<CliffordGate> readAll(GateSource& source) {
+  std::vector<CliffordGate> gates;
+  for (auto gate = source.next(); gate.has_value(); gate = source.next()) {
+    gates.emplace_back(*gate);
+  }
+  return gates;
+}
+} // namespace
+
+TEST(GateSourceTest, LevelsKeepTheGateOrderOfEveryQubit) {
+  std::mt19937 gen(53U);
+  for (const std::size_t window : {1U, 3U, 64U}) {
+    auto circuit = qc::createRandomCliffordCircuit(7, 30, gen());
+    qc::CircuitOptimizer::flattenOperations(circuit);
+
+    // reference: all gates applied in program order
+    Tableau           expected(7U);
+    CircuitGateSource gates(circuit);
+    for (const auto& gate : readAll(gates)) {
+      apply(expected, gate);
+    }
+
+    CircuitGateSource         source(circuit);
+    LevelStream               stream(source, window);
+    Tableau                   actual(7U);
+    std::vector<CliffordGate> level;
+    std::size_t               nrOfLevels = 0U;
+    while (stream.next(level)) {
+      std::set<unsigned long> used;
+      for (const auto& gate : level) {
+        EXPECT_TRUE(used.insert(gate.target).second);
+        EXPECT_TRUE(!gate.twoQubit() || used.insert(gate.control).second);
+        apply(actual, gate);
+      }
+      nrOfLevels++;
+    }
+    EXPECT_EQ(actual, expected) << "window " << window;
+    EXPECT_EQ(stream.gates(), circuit.size());
+    EXPECT_LE(nrOfLevels, circuit.size());
+  }
+}
+
+TEST(GateSourceTest, ScheduledLevelsCommuteDiagonalGates) {
+  // X(1) H(1) H(0) CX(0, 1) S(0) X(2)
+  const CliffordGate              x1{qc::OpType::X, 1U, 0U, false};
+  const CliffordGate              h1{qc::OpType::H, 1U, 0U, false};
+  const CliffordGate              h0{qc::OpType::H, 0U, 0U, false};
+  const CliffordGate              cx{qc::OpType::X, 1U, 0U, true};
+  const CliffordGate              s0{qc::OpType::S, 0U, 0U, false};
+  const CliffordGate              x2{qc::OpType::X, 2U, 0U, false};
+  const std::vector<CliffordGate> gates{x1, h1, h0, cx, s0, x2};
+
+  // S passes the control of the CNOT into the gap after H(0), and X(2) is
+  // free to move to either end
+  const std::vector<std::vector<CliffordGate>> asap{
+      {x1, h0, x2}, {h1, s0}, {cx}};
+  EXPECT_EQ(scheduleLevels(gates, 3U, LevelScheduling::AsSoonAsPossible),
+            asap);
+  const std::vector<std::vector<CliffordGate>> alap{
+      {x1, h0}, {h1, s0}, {cx, x2}};
+  EXPECT_EQ(scheduleLevels(gates, 3U, LevelScheduling::AsLateAsPossible),
+            alap);
+  EXPECT_THROW((void)scheduleLevels({{qc::OpType::H, 2U, 0U, false}}, 2U,
+                                    LevelScheduling::AsSoonAsPossible),
+               std::invalid_argument);
+
+  // random circuits keep their tableau under both schedules
+  std::mt19937 gen(59U);
+  auto         circuit = qc::createRandomCliffordCircuit(6, 40, gen());
+  qc::CircuitOptimizer::flattenOperations(circuit);
+  CircuitGateSource source(circuit);
+  const auto        program = readAll(source);
+  Tableau           expected(6U);
+  for (const auto& gate : program) {
+    apply(expected, gate);
+  }
+  for (const auto scheduling : {LevelScheduling::AsSoonAsPossible,
+                                LevelScheduling::AsLateAsPossible}) {
+    Tableau actual(6U);
+    for (const auto& level : scheduleLevels(program, 6U, scheduling)) {
+      std::set<unsigned long> used;
+      for (const auto& gate : level) {
+        EXPECT_TRUE(used.insert(gate.target).second);
+        EXPECT_TRUE(!gate.twoQubit() || used.insert(gate.control).second);
+        apply(actual, gate);
+      }
+    }
+    EXPECT_EQ(actual, expected) << toString(scheduling);
+  }
+}
+
+TEST(GateSourceTest, QasmSourceParsesRegistersAndBroadcasts) {
+  std::istringstream program(R"(OPENQASM 2.0;
+include "qelib1.inc";
+// two registers, addressed one after the other
+qreg a[2];
+qreg b[1];
+creg c[3];
+h a; /* broadcast over
+        the register */
+cx a[1], b[0];
+barrier a, b;
+sdg b[0]; id a[0];
+cx a, b;
+)");
+  QasmGateSource source(program);
+  EXPECT_EQ(source.qubits(), 3U);
+  const std::vector<CliffordGate> expected{
+      {qc::OpType::H, 0U, 0U, false},   {qc::OpType::H, 1U, 0U, false},
+      {qc::OpType::X, 2U, 1U, true},    {qc::OpType::Sdg, 2U, 0U, false},
+      {qc::OpType::I, 0U, 0U, false},   {qc::OpType::X, 2U, 0U, true},
+      {qc::OpType::X, 2U, 1U, true}};
+  EXPECT_EQ(readAll(source), expected);
+
+  std::istringstream qasm3("OPENQASM 3.0;\nqubit[2] q;\nqubit r;\nt q[0];");
+  QasmGateSource     unsupported(qasm3);
+  EXPECT_EQ(unsupported.qubits(), 3U);
+  EXPECT_THROW(unsupported.next(), std::invalid_argument);
+
+  std::istringstream outOfRange("qreg q[1];\nh q[1];");
+  QasmGateSource     invalid(outOfRange);
+  EXPECT_THROW(invalid.next(), std::invalid_argument);
+
+  auto circuit = qc::QuantumComputation(1);
+  circuit.t(0);
+  CircuitGateSource nonClifford(circuit);
+  EXPECT_THROW(nonClifford.next(), std::invalid_argument);
+}
+
+TEST(GateSourceTest, TwoQubitCliffordGates) {
+  std::istringstream program(R"(OPENQASM 2.0;
+qreg q[3];
+cz q[0], q[2]; cy q[1], q[0];
+swap q[2], q[1]; iswap q[0], q[1];
+dcx q[1], q[2]; ecr q[0], q[2];
+sx q[1]; sxdg q[1];
+)");
+  QasmGateSource source(program);
+  const std::vector<CliffordGate> expected{
+      {qc::OpType::Z, 2U, 0U, true},        {qc::OpType::Y, 0U, 1U, true},
+      {qc::OpType::SWAP, 1U, 2U, false},    {qc::OpType::iSWAP, 1U, 0U, false},
+      {qc::OpType::DCX, 2U, 1U, false},     {qc::OpType::ECR, 2U, 0U, false},
+      {qc::OpType::SX, 1U, 0U, false},      {qc::OpType::SXdg, 1U, 0U, false}};
+  const auto gates = readAll(source);
+  EXPECT_EQ(gates, expected);
+  EXPECT_TRUE(gates[2].twoQubit());
+  EXPECT_FALSE(gates[6].twoQubit());
+
+  // the same gates from a circuit, in the levels of the stream
+  auto circuit = qc::QuantumComputation(3);
+  circuit.cz(0, 2);
+  circuit.cy(1, 0);
+  circuit.swap(2, 1);
+  circuit.iswap(0, 1);
+  circuit.dcx(1, 2);
+  circuit.ecr(0, 2);
+  circuit.sx(1);
+  circuit.sxdg(1);
+  CircuitGateSource fromCircuit(circuit);
+  EXPECT_EQ(readAll(fromCircuit), expected);
+
+  // gates that act twice on a qubit, and controlled gates without a Pauli
+  // target are rejected
+  std::istringstream twice("qreg q[2];\nswap q[1], q[1];");
+  QasmGateSource     invalid(twice);
+  EXPECT_THROW(invalid.next(), std::invalid_argument);
+  auto controlledH = qc::QuantumComputation(2);
+  controlledH.ch(0, 1);
+  EXPECT_FALSE(CircuitGateSource::isSupported(**controlledH.begin()));
+}
+
+TEST(GateSourceTest, StreamedEquivalenceChecks) {
+  // X = H Z H, read from a circuit and from an OpenQASM program
+  auto circOne = qc::QuantumComputation(2);
+  circOne.x(0);
+  circOne.cx(0, 1);
+  std::istringstream program(
+      "OPENQASM 3.0;\nqubit[2] q;\nh q[0];\nz q[0];\nh q[0];\ncx q[0], q[1];");
+  const std::vector<std::string> inputs{"ZZ", "xZ", "yX"};
+  CircuitGateSource              sourceOne(circOne);
+  QasmGateSource                 sourceTwo(program);
+  SatEncoder                     encoder{};
+  EXPECT_TRUE(encoder.testEqual(sourceOne, sourceTwo, inputs));
+  EXPECT_EQ(encoder.getStats().nrOfGates, 6U);
+  EXPECT_EQ(encoder.getStats().circuitDepth, 4U);
+
+  // dropping the X is noticed for the all-zero state
+  auto circTwo = qc::QuantumComputation(2);
+  circTwo.cx(0, 1);
+  CircuitGateSource again(circOne);
+  CircuitGateSource withoutX(circTwo);
+  SatEncoder        different{};
+  EXPECT_FALSE(different.testEqual(again, withoutX, {}));
+  EXPECT_TRUE(different.getStats().counterexample.found);
+
+  // sources of different widths and empty sources are rejected
+  auto              wide = qc::QuantumComputation(3);
+  CircuitGateSource narrowSource(circOne);
+  CircuitGateSource wideSource(wide);
+  SatEncoder        widths{};
+  EXPECT_FALSE(widths.testEqual(narrowSource, wideSource, {}));
+  auto              empty = qc::QuantumComputation(2);
+  CircuitGateSource full(circOne);
+  CircuitGateSource emptySource(empty);
+  SatEncoder        emptyEncoder{};
+  EXPECT_FALSE(emptyEncoder.testEqual(full, emptySource, {}));
+  EXPECT_FALSE(emptyEncoder.getStats().counterexample.found);
+
+  // random circuits agree with themselves for every check and window
+  std::mt19937 gen(59U);
+  auto         circThree = qc::createRandomCliffordCircuit(5, 20, gen());
+  qc::CircuitOptimizer::flattenOperations(circThree);
+  Configuration direct{};
+  direct.equivalenceCheck = EquivalenceCheck::Direct;
+  direct.streamWindow     = 2U;
+  Configuration unitary{};
+  unitary.equivalenceCheck = EquivalenceCheck::Unitary;
+  unitary.crossCheck       = true;
+  for (const auto& config : {Configuration{}, direct, unitary}) {
+    CircuitGateSource left(circThree);
+    CircuitGateSource right(circThree);
+    SatEncoder        same(config);
+    EXPECT_TRUE(same.testEqual(left, right, {"ZZZZZ", "xyXYZ"}));
+  }
+
+  CircuitGateSource satSource(circThree);
+  SatEncoder        satEncoder{};
+  EXPECT_TRUE(satEncoder.checkSatisfiability(satSource, {"xZZZZ", "ZZZZZ"}));
+  EXPECT_GT(satEncoder.getStats().nrOfSatVars, 0U);
+  CircuitGateSource dimacsSource(circThree);
+  SatEncoder        dimacsEncoder{};
+  EXPECT_EQ(dimacsEncoder.generateDIMACS(dimacsSource).rfind("p cnf", 0U), 0U);
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "Configuration.hpp"
+#include "GeneratorCache.hpp"
+#include "SatEncoder.hpp"
+#include "algorithms/RandomCliffordCircuit.hpp"
+#include "circuit_optimizer/CircuitOptimizer.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+std::string cachePath(const std::string& name) {
+  const auto path = ::testing::TempDir() + name;
+  std::remove(path.c_str());
+  return path;
+}
+
+void appendWords(const std::string&                path,
+                 const std::vector<std::uint64_t>& words,
+                 const std::size_t                 bytes) {
+  std::ofstream stream(path, std::ios::binary | std::ios::app);
+  stream.write(reinterpret_cast<const char*>(words.data()),
+               static_cast<std::streamsize>(bytes));
+}
+} // namespace
+
+TEST(GeneratorCacheTest, ReplaysStoredCircuits) {
+  std::mt19937 gen(61U);
+  auto         circOne = qc::createRandomCliffordCircuit(4, 12, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  auto circTwo = circOne;
+  circTwo.h(1);
+  circTwo.h(1);
+  const std::vector<std::string> inputs{"ZZZZ", "xZyZ", "XYZZ"};
+
+  Configuration config{};
+  config.cacheFile = cachePath("qusat_replay.cache");
+  SatEncoder first(config);
+  EXPECT_TRUE(first.testEqual(circOne, circTwo, inputs));
+  EXPECT_EQ(first.getStats().nrOfCachedLevels, 0U);
+
+  // the same check is replayed entirely and ends with the same generators
+  SatEncoder second(config);
+  EXPECT_TRUE(second.testEqual(circOne, circTwo, inputs));
+  EXPECT_GT(second.getStats().nrOfCachedLevels, 0U);
+  EXPECT_EQ(second.getStats().nrOfGenerators, first.getStats().nrOfGenerators);
+  EXPECT_EQ(second.getStats().nrOfSatVars, first.getStats().nrOfSatVars);
+
+  // a circuit that extends a stored one resumes after the stored levels
+  auto circThree = circTwo;
+  circThree.x(2);
+  Configuration direct    = config;
+  direct.equivalenceCheck = EquivalenceCheck::Direct;
+  SatEncoder third(direct);
+  EXPECT_FALSE(third.testEqual(circTwo, circThree, inputs));
+  EXPECT_GT(third.getStats().nrOfCachedLevels, 0U);
+  Configuration uncached = direct;
+  uncached.cacheFile.clear();
+  SatEncoder reference(uncached);
+  EXPECT_FALSE(reference.testEqual(circTwo, circThree, inputs));
+  EXPECT_EQ(third.getStats().counterexample.input,
+            reference.getStats().counterexample.input);
+
+  // other inputs are not replayed
+  SatEncoder fourth(config);
+  EXPECT_TRUE(fourth.testEqual(circOne, circTwo, {"ZZZZ"}));
+  EXPECT_EQ(fourth.getStats().nrOfCachedLevels, 0U);
+  std::remove(config.cacheFile.c_str());
+}
+
+TEST(GeneratorCacheTest, SkipsTornRecordsAndOtherVersions) {
+  auto circuit = qc::QuantumComputation(2);
+  circuit.h(0);
+  circuit.cx(0, 1);
+  circuit.s(1);
+
+  Configuration config{};
+  config.cacheFile = cachePath("qusat_torn.cache");
+  SatEncoder first(config);
+  EXPECT_TRUE(first.checkSatisfiability(circuit, {}));
+
+  // a record torn by a crash: a marker and a size, but no payload
+  appendWords(config.cacheFile, {0x31434552474b4351ULL, 40U, 7U, 1U}, 27U);
+  SatEncoder second(config);
+  EXPECT_TRUE(second.checkSatisfiability(circuit, {"xZ"}));
+  EXPECT_EQ(second.getStats().nrOfCachedLevels, 0U);
+
+  // records before and after the torn one are found
+  const GeneratorCache cache(config.cacheFile);
+  EXPECT_TRUE(cache.usable());
+  EXPECT_EQ(cache.size(), 2U);
+  SatEncoder third(config);
+  EXPECT_TRUE(third.checkSatisfiability(circuit, {"xZ"}));
+  EXPECT_EQ(third.getStats().nrOfCachedLevels, third.getStats().circuitDepth);
+
+  // files of another version are neither read nor extended
+  const auto other = cachePath("qusat_version.cache");
+  appendWords(other,
+              {0x0043475441535551ULL, GeneratorCache::VERSION + 1U,
+               0x0102030405060708ULL},
+              24U);
+  config.cacheFile = other;
+  SatEncoder fourth(config);
+  EXPECT_TRUE(fourth.checkSatisfiability(circuit, {}));
+  EXPECT_EQ(fourth.getStats().nrOfCachedLevels, 0U);
+  const GeneratorCache unsupported(other);
+  EXPECT_FALSE(unsupported.usable());
+  EXPECT_EQ(unsupported.size(), 0U);
+  std::remove(other.c_str());
+  std::remove(cachePath("qusat_torn.cache").c_str());
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CancellationToken.hpp"
+#include "CdclSolver.hpp"
+#include "CnfBuilder.hpp"
+#include "Configuration.hpp"
+#include "SatBackend.hpp"
+#include "SatEncoder.hpp"
+#include "algorithms/RandomCliffordCircuit.hpp"
+#include "circuit_optimizer/CircuitOptimizer.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+CnfBuilder randomThreeSat(const std::size_t variables,
+                          const std::size_t clauses, std::mt19937& gen) {
+  CnfBuilder                         cnf{};
+  std::uniform_int_distribution<int> var(1, static_cast<int>(variables));
+  std::bernoulli_distribution        sign(0.5);
+  cnf.newVariables(variables);
+  for (std::size_t i = 0U; i < clauses; i++) {
+    cnf.addClause({sign(gen) ? var(gen) : -var(gen),
+                   sign(gen) ? var(gen) : -var(gen),
+                   sign(gen) ? var(gen) : -var(gen)});
+  }
+  return cnf;
+}
+
+// p pigeons in h holes, unsatisfiable and hard to refute if p > h
+CnfBuilder pigeonhole(const std::size_t pigeons, const std::size_t holes) {
+  CnfBuilder                                    cnf{};
+  std::vector<std::vector<CnfBuilder::Literal>> in(pigeons);
+  for (auto& row : in) {
+    row = cnf.newVariables(holes);
+    cnf.addClause(row);
+  }
+  for (std::size_t h = 0U; h < holes; h++) {
+    for (std::size_t p = 0U; p < pigeons; p++) {
+      for (std::size_t q = p + 1U; q < pigeons; q++) {
+        cnf.addClause({-in[p][h], -in[q][h]});
+      }
+    }
+  }
+  return cnf;
+}
+
+bool modelSatisfies(const SatBackend& backend, const CnfBuilder& cnf) {
+  bool result = true;
+  cnf.forEachClause([&](const CnfBuilder::Literal* first,
+                        const CnfBuilder::Literal* last) {
+    bool satisfied = false;
+    for (const auto* it = first; it != last; ++it) {
+      satisfied |= backend.value(*it);
+    }
+    result &= satisfied;
+  });
+  return result;
+}
+} // namespace
+
+TEST(SatBackendTest, CdclAgreesWithZ3OnRandomThreeSat) {
+  std::mt19937 gen(99U);
+  // around the phase transition both outcomes occur frequently
+  for (std::size_t round = 0U; round < 60U; round++) {
+    const auto cnf  = randomThreeSat(40U, 170U, gen);
+    const auto z3   = SatBackend::create(SatBackendType::Z3);
+    const auto cdcl = SatBackend::create(SatBackendType::CDCL);
+    z3->addCnf(cnf);
+    cdcl->addCnf(cnf);
+    const auto expected = z3->solve();
+    EXPECT_EQ(cdcl->solve(), expected);
+    if (expected == SatResult::Satisfiable) {
+      EXPECT_TRUE(modelSatisfies(*cdcl, cnf));
+    }
+  }
+}
+
+TEST(SatBackendTest, CdclIsIncrementalUnderAssumptions) {
+  CdclSolver solver{};
+  const std::vector<CnfBuilder::Literal> ab{1, 2};
+  solver.addClause(ab.data(), ab.data() + ab.size()); // a or b
+  solver.assume(-1);
+  solver.assume(-2);
+  EXPECT_EQ(solver.solve(), SatResult::Unsatisfiable);
+  // assumptions only hold for one call
+  solver.assume(-1);
+  EXPECT_EQ(solver.solve(), SatResult::Satisfiable);
+  EXPECT_TRUE(solver.value(2));
+  const std::vector<CnfBuilder::Literal> notB{-2};
+  solver.addClause(notB.data(), notB.data() + notB.size());
+  EXPECT_EQ(solver.solve(), SatResult::Satisfiable);
+  EXPECT_TRUE(solver.value(1));
+  solver.assume(-1);
+  EXPECT_EQ(solver.solve(), SatResult::Unsatisfiable);
+  EXPECT_GT(solver.statistics().at("solves"), 3.);
+}
+
+TEST(SatBackendTest, CdclRefutesPigeonhole) {
+  // 7 pigeons do not fit into 6 holes
+  CdclSolver solver{};
+  solver.addCnf(pigeonhole(7U, 6U));
+  EXPECT_EQ(solver.solve(), SatResult::Unsatisfiable);
+}
+
+TEST(SatBackendTest, CdclDropsReducedLearntClauses) {
+  // 8 pigeons in 7 holes take enough conflicts for several reductions
+  const auto cnf = pigeonhole(8U, 7U);
+  CdclSolver solver{};
+  solver.addCnf(cnf);
+  EXPECT_EQ(solver.solve(), SatResult::Unsatisfiable);
+  const auto stats = solver.statistics();
+  EXPECT_GT(stats.at("reductions"), 0.);
+  EXPECT_EQ(stats.at("clauses"), static_cast<double>(cnf.clauses()));
+  EXPECT_LT(stats.at("learnts"), stats.at("conflicts"));
+}
+
+TEST(SatBackendTest, BackendsGiveUpAfterTheDeadline) {
+  std::mt19937 gen(13U);
+  const auto   cnf = randomThreeSat(60U, 250U, gen);
+  for (const auto type : {SatBackendType::Z3, SatBackendType::CDCL}) {
+    const auto backend = SatBackend::create(type);
+    backend->addCnf(cnf);
+    SolverLimits limits{};
+    limits.deadline = std::chrono::steady_clock::now();
+    backend->setLimits(limits);
+    EXPECT_EQ(backend->solve(), SatResult::Unknown);
+    EXPECT_EQ(backend->interruption(), Interruption::Timeout);
+    limits.deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    backend->setLimits(limits);
+    EXPECT_NE(backend->solve(), SatResult::Unknown);
+    EXPECT_EQ(backend->interruption(), Interruption::None);
+  }
+}
+
+TEST(SatBackendTest, BackendsStopAtTheResourceLimit) {
+  const auto cnf = pigeonhole(9U, 8U);
+  for (const auto type : {SatBackendType::Z3, SatBackendType::CDCL}) {
+    const auto backend = SatBackend::create(type);
+    backend->addCnf(cnf);
+    SolverLimits limits{};
+    limits.resourceLimit = 1000U;
+    backend->setLimits(limits);
+    EXPECT_EQ(backend->solve(), SatResult::Unknown);
+    EXPECT_EQ(backend->interruption(), Interruption::ResourceLimit);
+  }
+}
+
+TEST(SatBackendTest, BackendsStopWhenCancelled) {
+  const auto cnf = pigeonhole(12U, 11U);
+  for (const auto type : {SatBackendType::Z3, SatBackendType::CDCL}) {
+    const auto backend = SatBackend::create(type);
+    backend->addCnf(cnf);
+    SolverLimits limits{};
+    limits.cancellation = CancellationToken{};
+    backend->setLimits(limits);
+    // cancelled from another thread while solving
+    std::thread canceller([&] {
+      std::this_thread::sleep_for(std::chrono::milliseconds(50));
+      limits.cancellation->cancel();
+    });
+    EXPECT_EQ(backend->solve(), SatResult::Unknown);
+    canceller.join();
+    EXPECT_EQ(backend->interruption(), Interruption::Cancelled);
+    // a cancelled token stops every following call right away
+    EXPECT_EQ(backend->solve(), SatResult::Unknown);
+    EXPECT_EQ(backend->interruption(), Interruption::Cancelled);
+  }
+}
+
+TEST(SatBackendTest, CancellationCallbacks) {
+  const CancellationToken token{};
+  std::size_t             calls = 0U;
+  {
+    const auto subscription = token.subscribe([&] { calls++; });
+    const auto copy         = token; // shares the state of the token
+    copy.cancel();
+    copy.cancel();
+  }
+  EXPECT_TRUE(token.cancelled());
+  EXPECT_EQ(calls, 1U);
+  // subscribing to a cancelled token calls back right away
+  const auto late = token.subscribe([&] { calls++; });
+  EXPECT_EQ(calls, 2U);
+}
+
+TEST(SatBackendTest, InterruptionNames) {
+  for (const auto interruption :
+       {Interruption::None, Interruption::Timeout, Interruption::MemoryLimit,
+        Interruption::ResourceLimit, Interruption::Cancelled}) {
+    EXPECT_EQ(interruptionFromString(toString(interruption)), interruption);
+  }
+  EXPECT_THROW(static_cast<void>(interruptionFromString("crash")),
+               std::invalid_argument);
+}
+
+TEST(SatBackendTest, BackendNames) {
+  EXPECT_EQ(satBackendFromString(toString(SatBackendType::CDCL)),
+            SatBackendType::CDCL);
+  EXPECT_EQ(satBackendFromString("z3"), SatBackendType::Z3);
+  EXPECT_THROW(static_cast<void>(satBackendFromString("minisat")),
+               std::invalid_argument);
+}
+
+TEST(SatBackendTest, EncoderVerdictsDoNotDependOnBackend) {
+  std::mt19937 gen(5U);
+  for (std::size_t i = 0U; i < 10U; i++) {
+    auto circOne = qc::createRandomCliffordCircuit(4, 8, gen());
+    qc::CircuitOptimizer::flattenOperations(circOne);
+    auto circTwo = circOne;
+    if (i % 2U == 1U) {
+      circTwo.erase(circTwo.begin());
+    }
+    const std::vector<std::string> inputs{"ZZZZ", "xyXY"};
+
+    SatEncoder    z3Encoder{};
+    Configuration config{};
+    config.backend = SatBackendType::CDCL;
+    SatEncoder cdclEncoder(config);
+    EXPECT_EQ(z3Encoder.testEqual(circOne, circTwo, inputs),
+              cdclEncoder.testEqual(circOne, circTwo, inputs));
+    EXPECT_EQ(cdclEncoder.getStats().satBackend, "cdcl");
+    EXPECT_FALSE(cdclEncoder.getStats().solverStatsMap.empty());
+  }
+}
@@ -12,14 +12,10 @@
 #include "algorithms/RandomCliffordCircuit.hpp"
 #include "circuit_optimizer/CircuitOptimizer.hpp"
 
-#include <ctime>
-#ifdef _MSC_VER
-#define localtime_r(a, b) (localtime_s(b, a) == 0 ? b : NULL)
-#endif
-
+#include <cstdio>
 #include <fstream>
 #include <gtest/gtest.h>
-#include <locale>
+#include <sstream>
 
 class SatEncoderTest : public testing::TestWithParam<std::string> {};
 
@@ -49,12 +45,19 @@ TEST_F(SatEncoderTest, CheckEqualWhenNotEqualRandomCircuits) {
   std::random_device rd;
   std::mt19937       gen(rd());
   auto               circOne = qc::createRandomCliffordCircuit(2, 1, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
 
-  while (circOne.empty()) {
+  // removing a leading diagonal gate does not change the all-zero input
+  const auto startsDiagonal = [](const qc::QuantumComputation& qc) {
+    const auto type = (*qc.begin())->getType();
+    return type == qc::OpType::I || type == qc::OpType::Z ||
+           type == qc::OpType::S || type == qc::OpType::Sdg;
+  };
+  while (circOne.empty() || startsDiagonal(circOne)) {
     circOne = qc::createRandomCliffordCircuit(2, 1, gen());
+    qc::CircuitOptimizer::flattenOperations(circOne);
   }
 
-  qc::CircuitOptimizer::flattenOperations(circOne);
   auto circTwo = circOne;
 
   circTwo.erase(circTwo.begin());
@@ -111,245 +114,775 @@ TEST_F(SatEncoderTest, CheckDIMACSConstructionWithSmallCircuit) {
   EXPECT_STRNE(result.c_str(), "");
 }
 
-/* Benchmarking */
-std::vector<std::string> getAllCompBasisStates(std::size_t nrQubits) {
-  if (nrQubits == 1) {
-    return {"I", "Z"};
+TEST_F(SatEncoderTest, ParallelPreprocessingIsDeterministic) {
+  std::mt19937 gen(17U);
+  auto         circOne = qc::createRandomCliffordCircuit(6, 20, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  auto circTwo = circOne;
+
+  std::vector<std::string>           inputs;
+  const std::string                  alphabet = "ZxXyY";
+  std::uniform_int_distribution<int> letter(0, 4);
+  for (std::size_t i = 0U; i < 40U; i++) {
+    std::string input;
+    for (std::size_t q = 0U; q < 6U; q++) {
+      input += alphabet[static_cast<std::size_t>(letter(gen))];
+    }
+    inputs.emplace_back(input);
   }
-  std::vector<std::string> rest = getAllCompBasisStates(nrQubits - 1);
-  std::vector<std::string> appended;
-  for (const auto& s : rest) {
-    appended.push_back(s + 'I');
-    appended.push_back(s + 'Z');
+
+  Configuration serialConfig{};
+  serialConfig.nThreads = 1U;
+  SatEncoder serial(serialConfig);
+  EXPECT_TRUE(serial.testEqual(circOne, circTwo, inputs));
+
+  Configuration parallelConfig{};
+  parallelConfig.nThreads = 4U;
+  SatEncoder parallel(parallelConfig);
+  EXPECT_TRUE(parallel.testEqual(circOne, circTwo, inputs));
+
+  EXPECT_EQ(serial.getStats().nrOfGenerators,
+            parallel.getStats().nrOfGenerators);
+  EXPECT_EQ(serial.getStats().nrOfFunctionalConstr,
+            parallel.getStats().nrOfFunctionalConstr);
+}
+
+TEST_F(SatEncoderTest, SharedPrefixIsSimulatedOnce) {
+  std::mt19937 gen(23U);
+  auto         circOne = qc::createRandomCliffordCircuit(5, 15, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  // same circuit with an additional gate at the end
+  auto circTwo = circOne;
+  circTwo.h(2);
+  const std::vector<std::string> inputs{"ZZZZZ", "xZyYX", "XXXXX"};
+
+  for (const auto equal : {true, false}) {
+    auto&         other = equal ? circOne : circTwo;
+    Configuration separateConfig{};
+    separateConfig.shareCommonPrefix = false;
+    SatEncoder separate(separateConfig);
+    SatEncoder shared{};
+    EXPECT_EQ(separate.testEqual(circOne, other, inputs), equal);
+    EXPECT_EQ(shared.testEqual(circOne, other, inputs), equal);
+    EXPECT_EQ(separate.getStats().nrOfGenerators,
+              shared.getStats().nrOfGenerators);
+    EXPECT_EQ(separate.getStats().nrOfFunctionalConstr,
+              shared.getStats().nrOfFunctionalConstr);
+    EXPECT_EQ(separate.getStats().nrOfGates, shared.getStats().nrOfGates);
   }
-  return appended;
 }
 
-class SatEncoderBenchmarking : public testing::TestWithParam<std::string> {
-public:
-  const std::string benchmarkFilesPath;
-};
-
-TEST_F(SatEncoderBenchmarking,
-       GrowingNrOfQubitsForFixedDepth) { // scaling wrt #qubits
-  try {
-    // Paper Evaluation:
-    // std::vector<std::size_t> depths = {10, 50, 250, 1000};
-    std::vector<std::size_t> depths = {10, 50};
-    for (unsigned long depth : depths) {
-      // 10, 1: 50, 2:  1000, 3: 250
-      std::size_t       nrOfQubits = 1U;
-      const std::size_t stepsize   = 1U;
-      // Paper Evaluation:
-      // const std::size_t  maxNrOfQubits = 128;
-      const std::size_t  maxNrOfQubits = 16;
-      std::random_device rd;
-      std::ostringstream oss;
-      auto               t = std::time(nullptr);
-      struct tm          now{};
-      localtime_r(&t, &now);
-      oss << std::put_time(&now, "%d-%m-%Y");
-      auto filename = oss.str();
-
-      std::ofstream outfile(benchmarkFilesPath + "QB-" + std::to_string(depth) +
-                            "-" + filename + ".json");
-      outfile << "{ \"benchmarks\" : [";
-
-      for (; nrOfQubits < maxNrOfQubits; nrOfQubits += stepsize) {
-        for (size_t j = 0; j < 10;
-             j++) { // 10 runs with same params for representative sample
-          SatEncoder satEncoder;
-          auto       circOne = qc::createRandomCliffordCircuit(
-              static_cast<qc::Qubit>(nrOfQubits), depth, rd());
-          qc::CircuitOptimizer::flattenOperations(circOne);
-          if (nrOfQubits != 1U || j != 0U) {
-            outfile << ", ";
-          }
-          satEncoder.checkSatisfiability(circOne);
-          outfile << satEncoder.to_json().dump(2U);
-        }
-      }
-      outfile << "]}";
-      outfile.close();
+TEST_F(SatEncoderTest, PauliGatesActNatively) {
+  // X = H Z H
+  auto circOne = qc::QuantumComputation(1);
+  circOne.x(0);
+  auto circTwo = qc::QuantumComputation(1);
+  circTwo.h(0);
+  circTwo.z(0);
+  circTwo.h(0);
+  const std::vector<std::string> inputs{"I", "Z", "x", "X", "y", "Y"};
+  SatEncoder                     encoder{};
+  EXPECT_TRUE(encoder.testEqual(circOne, circTwo, inputs));
+
+  // Z = S S, Y ~ X Z
+  auto circThree = qc::QuantumComputation(2);
+  circThree.z(0);
+  circThree.y(1);
+  auto circFour = qc::QuantumComputation(2);
+  circFour.s(0);
+  circFour.s(0);
+  circFour.z(1);
+  circFour.x(1);
+  SatEncoder encoderTwo{};
+  EXPECT_TRUE(encoderTwo.testEqual(circThree, circFour, {"xy", "XY", "yZ"}));
+
+  // Z and X differ on |+>
+  auto circFive = qc::QuantumComputation(1);
+  circFive.z(0);
+  SatEncoder encoderThree{};
+  EXPECT_FALSE(encoderThree.testEqual(circOne, circFive, {"x"}));
+}
+
+TEST_F(SatEncoderTest, LevelsFollowGatesAcrossQubits) {
+  // the CNOT is the third gate of qubit 0, but the first of qubit 1, and Z
+  // does not commute with its target
+  auto circOne = qc::QuantumComputation(2);
+  circOne.h(0);
+  circOne.h(0);
+  circOne.cx(0, 1);
+  circOne.z(1);
+  auto circTwo = qc::QuantumComputation(2);
+  circTwo.cx(0, 1);
+  circTwo.z(1);
+  Configuration unitaryConfig{};
+  unitaryConfig.equivalenceCheck = EquivalenceCheck::Unitary;
+  SatEncoder unitary(unitaryConfig);
+  EXPECT_TRUE(unitary.testEqual(circOne, circTwo));
+  EXPECT_EQ(unitary.getStats().nrOfGates, 6U);
+
+  // diagonal gates commute with the control of the CNOT, so S fills the gap
+  // before it and the depth is the number of gates on qubit 0
+  auto circThree = qc::QuantumComputation(3);
+  circThree.x(1);
+  circThree.cx(0, 1);
+  circThree.s(0);
+  circThree.cz(0, 2);
+  for (const auto scheduling : {LevelScheduling::AsSoonAsPossible,
+                                LevelScheduling::AsLateAsPossible}) {
+    Configuration config{};
+    config.levelScheduling = scheduling;
+    SatEncoder encoder(config);
+    EXPECT_TRUE(encoder.checkSatisfiability(circThree, {}));
+    EXPECT_EQ(encoder.getStats().circuitDepth, 3U) << toString(scheduling);
+    auto reordered = qc::QuantumComputation(3);
+    reordered.cz(0, 2);
+    reordered.s(0);
+    reordered.x(1);
+    reordered.cx(0, 1);
+    SatEncoder miter(config);
+    EXPECT_TRUE(
+        miter.testEqual(circThree, reordered, {"ZZZ", "xyZ", "XYy", "yxX"}));
+  }
+}
+
+TEST_F(SatEncoderTest, TwoQubitGatesActNatively) {
+  auto native = qc::QuantumComputation(3);
+  native.cz(0, 1);
+  native.cy(1, 2);
+  native.swap(0, 2);
+  native.iswap(1, 2);
+  native.dcx(0, 1);
+  native.ecr(2, 0);
+  native.sx(0);
+  native.v(1);
+  native.vdg(2);
+  native.sxdg(1);
+
+  // decompositions into H, S, Sdg, X and CNOT, up to global phase
+  auto decomposed = qc::QuantumComputation(3);
+  const auto sx   = [&](const qc::Qubit q) {
+    decomposed.h(q);
+    decomposed.s(q);
+    decomposed.h(q);
+  };
+  const auto sxdg = [&](const qc::Qubit q) {
+    decomposed.h(q);
+    decomposed.sdg(q);
+    decomposed.h(q);
+  };
+  decomposed.h(1);
+  decomposed.cx(0, 1);
+  decomposed.h(1);
+  decomposed.sdg(2);
+  decomposed.cx(1, 2);
+  decomposed.s(2);
+  decomposed.cx(0, 2);
+  decomposed.cx(2, 0);
+  decomposed.cx(0, 2);
+  decomposed.s(1);
+  decomposed.s(2);
+  decomposed.h(1);
+  decomposed.cx(1, 2);
+  decomposed.cx(2, 1);
+  decomposed.h(2);
+  decomposed.cx(0, 1);
+  decomposed.cx(1, 0);
+  decomposed.s(2);
+  sx(0);
+  decomposed.cx(2, 0);
+  decomposed.x(2);
+  sx(0);
+  sx(1);
+  sxdg(2);
+  sxdg(1);
+
+  Configuration unitaryConfig{};
+  unitaryConfig.equivalenceCheck = EquivalenceCheck::Unitary;
+  SatEncoder unitary(unitaryConfig);
+  EXPECT_TRUE(unitary.testEqual(native, decomposed));
+  SatEncoder miter{};
+  EXPECT_TRUE(miter.testEqual(native, decomposed, {"ZZZ", "xyZ", "XYy"}));
+
+  // the native circuit needs fewer levels and thus fewer level variables
+  SatEncoder nativeEncoder{};
+  EXPECT_TRUE(nativeEncoder.checkSatisfiability(native, {}));
+  SatEncoder decomposedEncoder{};
+  EXPECT_TRUE(decomposedEncoder.checkSatisfiability(decomposed, {}));
+  EXPECT_LT(nativeEncoder.getStats().circuitDepth,
+            decomposedEncoder.getStats().circuitDepth);
+
+  // iSWAP differs from SWAP by phases
+  auto swap = qc::QuantumComputation(2);
+  swap.swap(0, 1);
+  auto iswap = qc::QuantumComputation(2);
+  iswap.iswap(0, 1);
+  SatEncoder different(unitaryConfig);
+  EXPECT_FALSE(different.testEqual(swap, iswap));
+}
+
+TEST_F(SatEncoderTest, TwoTargetGatesFollowGatesAcrossQubits) {
+  // the SWAP is the third gate of qubit 0 but the first of qubit 2, so the H
+  // on qubit 2 is leveled after it, and every later gate after both
+  auto native = qc::QuantumComputation(3);
+  native.h(0);
+  native.s(0);
+  native.swap(0, 2);
+  native.h(2);
+  native.iswap(1, 2);
+  native.dcx(0, 1);
+  native.ecr(2, 0);
+
+  auto decomposed = qc::QuantumComputation(3);
+  decomposed.h(0);
+  decomposed.s(0);
+  decomposed.cx(0, 2);
+  decomposed.cx(2, 0);
+  decomposed.cx(0, 2);
+  decomposed.h(2);
+  decomposed.s(1);
+  decomposed.s(2);
+  decomposed.h(1);
+  decomposed.cx(1, 2);
+  decomposed.cx(2, 1);
+  decomposed.h(2);
+  decomposed.cx(0, 1);
+  decomposed.cx(1, 0);
+  decomposed.s(2);
+  decomposed.h(0);
+  decomposed.s(0);
+  decomposed.h(0);
+  decomposed.cx(2, 0);
+  decomposed.x(2);
+
+  // the H before the SWAP acts on the other qubit
+  auto early = qc::QuantumComputation(3);
+  early.h(0);
+  early.s(0);
+  early.h(2);
+  early.swap(0, 2);
+  early.iswap(1, 2);
+  early.dcx(0, 1);
+  early.ecr(2, 0);
+
+  for (const auto scheduling : {LevelScheduling::AsSoonAsPossible,
+                                LevelScheduling::AsLateAsPossible}) {
+    Configuration config{};
+    config.levelScheduling = scheduling;
+    SatEncoder levels(config);
+    EXPECT_TRUE(levels.checkSatisfiability(native, {}));
+    EXPECT_EQ(levels.getStats().circuitDepth, 7U) << toString(scheduling);
+
+    config.equivalenceCheck = EquivalenceCheck::Unitary;
+    SatEncoder unitary(config);
+    EXPECT_TRUE(unitary.testEqual(native, decomposed)) << toString(scheduling);
+    SatEncoder different(config);
+    EXPECT_FALSE(different.testEqual(native, early)) << toString(scheduling);
+  }
+}
+
+TEST_F(SatEncoderTest, GeneratorEncodingsAgree) {
+  std::mt19937 gen(31U);
+  const std::vector<std::string> inputs{"ZZZZ", "xZyY", "XXZZ", "yyxx"};
+  for (std::size_t run = 0U; run < 10U; run++) {
+    auto circOne = qc::createRandomCliffordCircuit(4, 8, gen());
+    qc::CircuitOptimizer::flattenOperations(circOne);
+    auto circTwo = circOne;
+    if (run % 2U == 1U && !circTwo.empty()) {
+      circTwo.erase(circTwo.begin() +
+                    static_cast<int>(gen() % circTwo.size()));
+    }
+
+    Configuration binaryConfig{};
+    SatEncoder    binary(binaryConfig);
+    const auto    expected = binary.testEqual(circOne, circTwo, inputs);
+    for (const auto type : {EncodingType::OneHot, EncodingType::Order}) {
+      Configuration config{};
+      config.encoding = type;
+      SatEncoder encoder(config);
+      EXPECT_EQ(encoder.testEqual(circOne, circTwo, inputs), expected)
+          << toString(type);
+      EXPECT_EQ(encoder.getStats().nrOfGenerators,
+                binary.getStats().nrOfGenerators);
+
+      SatEncoder satEncoder(config);
+      EXPECT_TRUE(satEncoder.checkSatisfiability(circOne, inputs));
     }
-  } catch (std::exception& e) {
-    std::cerr << "EXCEPTION THROWN" << std::endl;
-    std::cout << e.what() << std::endl;
   }
 }
 
-TEST_F(SatEncoderBenchmarking,
-       GrowingCircuitSizeForFixedQubits) { // scaling wrt to circuit size
-  try {
-    // Paper Evaluation:
-    // std::vector<std::size_t> qubits = {5, 20, 65, 127};
-    std::vector<std::size_t> qubits = {5, 20};
-    for (unsigned long nrOfQubits : qubits) {
-      std::size_t depth = 1U;
-      // Paper Evaluation:
-      // std::size_t        maxDepth = 500;
-      std::size_t        maxDepth = 50U;
-      const std::size_t  stepsize = 5U;
-      std::random_device rd;
-      std::ostringstream oss;
-      auto               t = std::time(nullptr);
-      struct tm          now{};
-      localtime_r(&t, &now);
-      oss << std::put_time(&now, "%d-%m-%Y");
-      auto filename = oss.str();
-
-      std::ofstream outfile(benchmarkFilesPath + "CS-" +
-                            std::to_string(nrOfQubits) + "-" + filename +
-                            ".json");
-      outfile << "{ \"benchmarks\" : [";
-      for (; depth <= maxDepth; depth += stepsize) {
-        for (size_t j = 0; j < 10;
-             j++) { // 10 runs with same params for representative sample
-          SatEncoder satEncoder;
-          auto       circOne = qc::createRandomCliffordCircuit(
-              static_cast<qc::Qubit>(nrOfQubits), depth, rd());
-          qc::CircuitOptimizer::flattenOperations(circOne);
-          if (depth != 1U || j != 0U) {
-            outfile << ", ";
-          }
-          satEncoder.checkSatisfiability(circOne);
-          outfile << satEncoder.to_json().dump(2U);
-        }
-      }
-      outfile << "]}";
-      outfile.close();
+TEST_F(SatEncoderTest, DirectComparisonOfOutputStates) {
+  Configuration directConfig{};
+  directConfig.equivalenceCheck = EquivalenceCheck::Direct;
+
+  // CNOT leaves |00> unchanged, but changes its tableau
+  auto circOne = qc::QuantumComputation(2);
+  circOne.cx(0, 1);
+  circOne.h(0);
+  auto circTwo = qc::QuantumComputation(2);
+  circTwo.h(0);
+  SatEncoder direct(directConfig);
+  EXPECT_TRUE(direct.testEqual(circOne, circTwo));
+  EXPECT_EQ(direct.getStats().nrOfSatVars, 0U);
+  EXPECT_EQ(direct.getStats().equivalenceCheck, "direct");
+  SatEncoder directWithInputs(directConfig);
+  EXPECT_FALSE(directWithInputs.testEqual(circOne, circTwo, {"IZ", "ZI"}));
+
+  // direct comparison never rejects what the miter accepts
+  std::mt19937                   gen(37U);
+  const std::vector<std::string> inputs{"ZZZZZ", "xZyYX", "XXZZI", "yyxxZ"};
+  for (std::size_t run = 0U; run < 20U; run++) {
+    auto circThree = qc::createRandomCliffordCircuit(5, 6, gen());
+    qc::CircuitOptimizer::flattenOperations(circThree);
+    auto circFour = circThree;
+    if (run % 2U == 1U) {
+      circFour.erase(circFour.begin() +
+                     static_cast<int>(gen() % circFour.size()));
+    }
+    SatEncoder miter{};
+    SatEncoder directEncoder(directConfig);
+    const auto miterResult  = miter.testEqual(circThree, circFour, inputs);
+    const auto directResult = directEncoder.testEqual(circThree, circFour,
+                                                      inputs);
+    EXPECT_TRUE(!miterResult || directResult);
+    if (run % 2U == 0U) {
+      EXPECT_TRUE(directResult);
     }
-  } catch (std::exception& e) {
-    std::cerr << "EXCEPTION THROWN" << std::endl;
-    std::cout << e.what() << std::endl;
   }
 }
 
-TEST_F(SatEncoderBenchmarking,
-       GrowingCircuitSizeForFixedQubitsGenerators) { // generators wrt circsize
-  try {
-    // Paper Evaluation:
-    // std::vector<std::size_t> qubits = {1,2,3};
-    std::vector<std::size_t> qubits = {2};
-    for (unsigned long nrOfQubits : qubits) {
-      std::size_t depth = 1U;
-      // Paper Evaluation:
-      // std::size_t        maxDepth = 100;
-      std::size_t        maxDepth = 10U;
-      const std::size_t  stepsize = 1U;
-      std::random_device rd;
-      std::ostringstream oss;
-      auto               t = std::time(nullptr);
-      struct tm          now{};
-      localtime_r(&t, &now);
-      oss << std::put_time(&now, "%d-%m-%Y");
-      auto filename = oss.str();
-
-      std::ofstream outfile(benchmarkFilesPath + "G-" +
-                            std::to_string(nrOfQubits) + "-" + filename +
-                            ".json");
-      outfile << "{ \"benchmarks\" : [";
-      for (; depth <= maxDepth; depth += stepsize) {
-        for (size_t j = 0; j < 10;
-             j++) { // 10 runs with same params for representative sample
-          SatEncoder satEncoder;
-          auto       circOne = qc::createRandomCliffordCircuit(
-              static_cast<qc::Qubit>(nrOfQubits), depth, rd());
-          qc::CircuitOptimizer::flattenOperations(circOne);
-          if (depth != 1U || j != 0U) {
-            outfile << ", ";
-          }
-          satEncoder.checkSatisfiability(circOne);
-          outfile << satEncoder.to_json().dump(2U);
-        }
-      }
-      outfile << "]}";
-      outfile.close();
+TEST_F(SatEncoderTest, UnitaryEquivalence) {
+  Configuration unitaryConfig{};
+  unitaryConfig.equivalenceCheck = EquivalenceCheck::Unitary;
+  unitaryConfig.crossCheck       = true;
+
+  // equal on |00>, but not as operators
+  auto circOne = qc::QuantumComputation(2);
+  circOne.cx(0, 1);
+  circOne.h(0);
+  auto circTwo = qc::QuantumComputation(2);
+  circTwo.h(0);
+  SatEncoder unitary(unitaryConfig);
+  EXPECT_FALSE(unitary.testEqual(circOne, circTwo));
+  EXPECT_EQ(unitary.getStats().equivalenceCheck, "unitary");
+
+  // CNOT with control and target swapped by Hadamards, and X = H Z H up to
+  // global phase
+  auto circThree = qc::QuantumComputation(2);
+  circThree.cx(0, 1);
+  circThree.x(1);
+  auto circFour = qc::QuantumComputation(2);
+  circFour.h(0);
+  circFour.h(1);
+  circFour.cx(1, 0);
+  circFour.h(1);
+  circFour.h(0);
+  circFour.h(1);
+  circFour.z(1);
+  circFour.h(1);
+  SatEncoder unitaryTwo(unitaryConfig);
+  EXPECT_TRUE(unitaryTwo.testEqual(circThree, circFour));
+
+  // S S = Z and S Sdg = I agree on |0>, but not as operators
+  auto circFive = qc::QuantumComputation(1);
+  circFive.s(0);
+  circFive.s(0);
+  auto circSix = qc::QuantumComputation(1);
+  circSix.s(0);
+  circSix.sdg(0);
+  SatEncoder stateEncoder{};
+  EXPECT_TRUE(stateEncoder.testEqual(circFive, circSix));
+  SatEncoder unitaryThree(unitaryConfig);
+  EXPECT_FALSE(unitaryThree.testEqual(circFive, circSix));
+
+  // random circuits agree with themselves and with every input state
+  std::mt19937 gen(41U);
+  for (std::size_t run = 0U; run < 10U; run++) {
+    auto circSeven = qc::createRandomCliffordCircuit(70, 10, gen());
+    qc::CircuitOptimizer::flattenOperations(circSeven);
+    auto circEight = circSeven;
+    circEight.erase(circEight.begin() +
+                    static_cast<int>(gen() % circEight.size()));
+    SatEncoder same(unitaryConfig);
+    EXPECT_TRUE(same.testEqual(circSeven, circSeven));
+    SatEncoder different(unitaryConfig);
+    const auto equal = different.testEqual(circSeven, circEight);
+    if (equal) {
+      SatEncoder miter{};
+      EXPECT_TRUE(miter.testEqual(circSeven, circEight,
+                                  {std::string(70, 'x'), std::string(70, 'y'),
+                                   std::string(70, 'Z')}));
     }
-  } catch (std::exception& e) {
-    std::cerr << "EXCEPTION THROWN" << std::endl;
-    std::cout << e.what() << std::endl;
   }
 }
 
-TEST_F(SatEncoderBenchmarking,
-       EquivalenceCheckingGrowingNrOfQubits) { // Equivalence Checking
-  try {
-    // Paper Evaluation:
-    // const std::size_t  depth         = 1000;
-    const std::size_t depth    = 100;
-    std::size_t       qubitCnt = 4;
-    const std::size_t stepsize = 4;
-    // Paper Evaluation:
-    // const std::size_t  maxNrOfQubits = 128;
-    const std::size_t  maxNrOfQubits = 16;
-    std::random_device rd;
-    std::random_device rd2;
-    std::random_device rd3;
-    std::random_device rd4;
-    std::ostringstream oss;
-    std::mt19937       gen(rd());
-    std::mt19937       gen2(rd());
-    auto               t = std::time(nullptr);
-    struct tm          now{};
-    localtime_r(&t, &now);
-    oss << std::put_time(&now, "%d-%m-%Y");
-    auto timestamp = oss.str();
-
-    std::ofstream outfile(benchmarkFilesPath + "EC-" + timestamp + ".json");
-    outfile << "{ \"benchmarks\" : [";
-
-    auto                                       ipts = getAllCompBasisStates(5);
-    std::uniform_int_distribution<std::size_t> distr(0U, 31U);
-
-    for (; qubitCnt < maxNrOfQubits; qubitCnt += stepsize) {
-      std::cout << "Nr Qubits: " << qubitCnt << std::endl;
-      SatEncoder               satEncoder;
-      std::vector<std::string> inputs;
-      for (size_t j = 0; j < 18; j++) {
-        inputs.emplace_back(ipts.at(distr(gen2)));
-      }
+TEST_F(SatEncoderTest, CounterexampleOfFailedCheck) {
+  // Z on qubit 2 only changes inputs with a superposition on qubit 2
+  auto circOne = qc::QuantumComputation(3);
+  circOne.h(0);
+  auto circTwo = qc::QuantumComputation(3);
+  circTwo.h(0);
+  circTwo.z(2);
+  const std::vector<std::string> inputs{"ZZZ", "xZZ", "ZZx"};
+  Configuration direct{};
+  direct.equivalenceCheck = EquivalenceCheck::Direct;
+  Configuration order{};
+  order.backend  = SatBackendType::CDCL;
+  order.encoding = EncodingType::Order;
+  for (const auto& config : {Configuration{}, direct, order}) {
+    SatEncoder encoder(config);
+    EXPECT_FALSE(encoder.testEqual(circOne, circTwo, inputs));
+    const auto& counterexample = encoder.getStats().counterexample;
+    EXPECT_TRUE(counterexample.found);
+    EXPECT_EQ(counterexample.input, 2U);
+    EXPECT_EQ(counterexample.state, "ZZx");
+    EXPECT_EQ(counterexample.level, 0U);
+  }
+
+  // H H H and H H S agree on |0> up to the last level
+  auto circThree = qc::QuantumComputation(1);
+  circThree.h(0);
+  circThree.h(0);
+  circThree.h(0);
+  auto circFour = qc::QuantumComputation(1);
+  circFour.h(0);
+  circFour.h(0);
+  circFour.s(0);
+  SatEncoder encoder{};
+  EXPECT_FALSE(encoder.testEqual(circThree, circFour));
+  const auto& counterexample = encoder.getStats().counterexample;
+  EXPECT_TRUE(counterexample.found);
+  EXPECT_EQ(counterexample.input, 0U);
+  EXPECT_EQ(counterexample.state, "I");
+  EXPECT_EQ(counterexample.level, 2U);
+
+  Statistics parsed{};
+  parsed.from_json(encoder.to_json());
+  EXPECT_TRUE(parsed.counterexample.found);
+  EXPECT_EQ(parsed.counterexample.level, 2U);
+
+  // the level counts the levels of the circuits, also those that the level
+  // compression dropped or composed, and those of preprocessed circuits
+  auto circFive = qc::QuantumComputation(1);
+  circFive.z(0);
+  circFive.z(0);
+  circFive.h(0);
+  circFive.h(0);
+  auto circSix = qc::QuantumComputation(1);
+  circSix.z(0);
+  circSix.z(0);
+  circSix.h(0);
+  circSix.s(0);
+  for (const auto compression : {LevelCompression::None,
+                                 LevelCompression::Identity,
+                                 LevelCompression::Full}) {
+    Configuration config{};
+    config.levelCompression = compression;
+    SatEncoder compressed(config);
+    EXPECT_FALSE(compressed.testEqual(circFive, circSix));
+    EXPECT_EQ(compressed.getStats().counterexample.level, 3U);
+
+    std::stringstream file;
+    SatEncoder(config).preprocess(circFive, circSix, {}, file);
+    SatEncoder decider{};
+    EXPECT_FALSE(decider.testEqual(file));
+    EXPECT_EQ(decider.getStats().counterexample.level, 3U);
+  }
 
-      auto circOne = qc::createRandomCliffordCircuit(
-          static_cast<qc::Qubit>(qubitCnt), depth, gen());
-      qc::CircuitOptimizer::flattenOperations(circOne);
-      auto circTwo = circOne;
-      if (qubitCnt != 4) {
-        outfile << ", ";
+  SatEncoder equal{};
+  EXPECT_TRUE(equal.testEqual(circOne, circOne, inputs));
+  EXPECT_FALSE(equal.getStats().counterexample.found);
+  EXPECT_TRUE(equal.to_json().at("counterexample").is_null());
+}
+
+TEST_F(SatEncoderTest, InterruptedChecksHaveNoVerdict) {
+  std::mt19937 gen(29U);
+  auto         circOne = qc::createRandomCliffordCircuit(3, 10, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  auto circTwo = circOne;
+
+  SatEncoder              cancelled{};
+  const CancellationToken token{};
+  token.cancel();
+  cancelled.setCancellationToken(token);
+  EXPECT_FALSE(cancelled.testEqual(circOne, circTwo));
+  EXPECT_EQ(cancelled.getStats().interruption, Interruption::Cancelled);
+  const auto output = cancelled.to_json();
+  EXPECT_TRUE(output.at("equivalent").is_null());
+  EXPECT_EQ(output.at("interruption"), "cancelled");
+  Statistics parsed{};
+  parsed.from_json(output);
+  EXPECT_FALSE(parsed.decided());
+  EXPECT_EQ(parsed.interruption, Interruption::Cancelled);
+
+  // the memory limit already stops the simulation
+  Configuration tiny{};
+  tiny.memoryLimit = 1U;
+  auto wide        = qc::QuantumComputation(3000); // 2 MB per tableau
+  for (std::size_t q = 0U; q < wide.getNqubits(); q++) {
+    wide.h(q);
+  }
+  SatEncoder limited(tiny);
+  EXPECT_FALSE(limited.checkSatisfiability(wide, {}));
+  EXPECT_EQ(limited.getStats().interruption, Interruption::MemoryLimit);
+
+  // an encoder decides its next check again
+  SatEncoder encoder{};
+  EXPECT_TRUE(encoder.testEqual(circOne, circTwo));
+  EXPECT_TRUE(encoder.getStats().decided());
+  EXPECT_TRUE(encoder.to_json().at("equivalent").get<bool>());
+}
+
+TEST_F(SatEncoderTest, ProfileTimesPhasesAndCountsEvents) {
+  if (!QUSAT_PROFILING) {
+    GTEST_SKIP() << "instrumentation compiled out";
+  }
+  std::mt19937 gen(31U);
+  auto         circOne = qc::createRandomCliffordCircuit(3, 10, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  auto circTwo = circOne;
+  circTwo.h(0);
+  circTwo.h(0);
+
+  Configuration config{};
+  config.trace = true;
+  SatEncoder encoder(config);
+  EXPECT_TRUE(encoder.testEqual(circOne, circTwo, {"ZZZ", "xZZ"}));
+  const auto& profile = encoder.getStats().profile;
+  for (const auto phase :
+       {ProfilePhase::DagConstruction, ProfilePhase::Simulation,
+        ProfilePhase::Interning, ProfilePhase::ConstraintBuilding,
+        ProfilePhase::Solving}) {
+    EXPECT_GT(profile.nanoseconds(phase), 0U) << toString(phase);
+  }
+  // every generator is a miss once, all other tableaus are hits
+  EXPECT_EQ(profile.value(ProfileCounter::InterningMisses),
+            encoder.getStats().nrOfGenerators);
+  EXPECT_GT(profile.value(ProfileCounter::InterningHits), 0U);
+  EXPECT_GE(profile.value(ProfileCounter::GatesApplied), 2U * 2U);
+  EXPECT_GT(profile.value(ProfileCounter::BytesAllocated), 0U);
+
+  Statistics parsed{};
+  parsed.from_json(encoder.to_json());
+  EXPECT_EQ(parsed.profile.to_json(), profile.to_json());
+
+  const auto trace  = profile.toChromeTrace();
+  const auto events = trace.at("traceEvents");
+  EXPECT_EQ(events.size(), profile.spans().size() + NR_OF_PROFILE_COUNTERS);
+  EXPECT_EQ(events.front().at("ph"), "X");
+  EXPECT_EQ(events.back().at("ph"), "C");
+
+  // without tracing only the totals are kept
+  SatEncoder untraced{};
+  EXPECT_TRUE(untraced.testEqual(circOne, circTwo));
+  EXPECT_TRUE(untraced.getStats().profile.spans().empty());
+  EXPECT_GT(untraced.getStats().profile.nanoseconds(ProfilePhase::Solving),
+            0U);
+}
+
+TEST_F(SatEncoderTest, LevelCompressionKeepsVerdicts) {
+  // Z leaves |0> unchanged, so its level needs no variables
+  auto circOne = qc::QuantumComputation(1);
+  circOne.z(0);
+  circOne.h(0);
+  circOne.z(0);
+  std::map<LevelCompression, std::size_t> vars{};
+  for (const auto compression : {LevelCompression::None,
+                                 LevelCompression::Identity,
+                                 LevelCompression::Full}) {
+    Configuration config{};
+    config.levelCompression = compression;
+    SatEncoder encoder(config);
+    EXPECT_TRUE(encoder.checkSatisfiability(circOne));
+    EXPECT_EQ(encoder.getStats().circuitDepth, 3U);
+    EXPECT_EQ(encoder.getStats().levelCompression, toString(compression));
+    vars[compression] = encoder.getStats().nrOfSatVars;
+  }
+  EXPECT_EQ(vars[LevelCompression::None], 4U);
+  EXPECT_EQ(vars[LevelCompression::Identity], 3U);
+  EXPECT_EQ(vars[LevelCompression::Full], 2U);
+
+  std::mt19937                   gen(61U);
+  const std::vector<std::string> inputs{"ZZZZ", "xZyY", "XXZZ", "yyxx"};
+  for (std::size_t run = 0U; run < 10U; run++) {
+    auto circTwo = qc::createRandomCliffordCircuit(4, 12, gen());
+    qc::CircuitOptimizer::flattenOperations(circTwo);
+    auto circThree = circTwo;
+    if (run % 2U == 1U) {
+      circThree.erase(circThree.begin() +
+                      static_cast<int>(gen() % circThree.size()));
+    }
+    SatEncoder uncompressed{};
+    const auto expected = uncompressed.testEqual(circTwo, circThree, inputs);
+    for (const auto compression :
+         {LevelCompression::Identity, LevelCompression::Full}) {
+      Configuration config{};
+      config.levelCompression = compression;
+      SatEncoder encoder(config);
+      EXPECT_EQ(encoder.testEqual(circTwo, circThree, inputs), expected);
+      EXPECT_LE(encoder.getStats().nrOfSatVars,
+                uncompressed.getStats().nrOfSatVars);
+      EXPECT_LE(encoder.getStats().nrOfFunctionalConstr,
+                uncompressed.getStats().nrOfFunctionalConstr);
+      EXPECT_EQ(encoder.getStats().counterexample.found,
+                uncompressed.getStats().counterexample.found);
+      if (compression == LevelCompression::Full) {
+        EXPECT_LE(encoder.getStats().nrOfSatVars, 4U);
       }
-      satEncoder.testEqual(circOne, circTwo, inputs); // equivalent case
-      outfile << satEncoder.to_json().dump(2U);
     }
+  }
+}
+
+TEST_F(SatEncoderTest, CircuitsAreLeveledAndCompressedWhileSimulated) {
+  // a circuit is checked like its gates read from a CircuitGateSource, in
+  // levels formed within the same window
+  std::mt19937 gen(67U);
+  auto         circOne = qc::createRandomCliffordCircuit(4, 40, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  auto circTwo = circOne;
+  circTwo.erase(circTwo.begin() + static_cast<int>(gen() % circTwo.size()));
+  const std::vector<std::string> inputs{"ZZZZ", "xZyY"};
+  Configuration                  narrow{};
+  narrow.streamWindow = 2U;
+  for (auto* other : {&circOne, &circTwo}) {
+    SatEncoder        circuits(narrow);
+    const auto        equal = circuits.testEqual(circOne, *other, inputs);
+    CircuitGateSource sourceOne(circOne);
+    CircuitGateSource sourceTwo(*other);
+    SatEncoder        sources(narrow);
+    EXPECT_EQ(sources.testEqual(sourceOne, sourceTwo, inputs), equal);
+    EXPECT_EQ(circuits.getStats().nrOfGates, sources.getStats().nrOfGates);
+    EXPECT_EQ(circuits.getStats().circuitDepth,
+              sources.getStats().circuitDepth);
+    EXPECT_EQ(circuits.getStats().nrOfGenerators,
+              sources.getStats().nrOfGenerators);
+  }
+
+  // only the composed mapping of a deep circuit is kept, and written
+  auto deep = qc::QuantumComputation(1);
+  for (std::size_t i = 0U; i < 200U; i++) {
+    deep.h(0);
+    deep.s(0);
+  }
+  std::map<LevelCompression, std::size_t> bytes{};
+  for (const auto compression :
+       {LevelCompression::None, LevelCompression::Full}) {
+    Configuration config{};
+    config.levelCompression = compression;
+    std::stringstream file;
+    SatEncoder(config).preprocess(deep, {"Z", "x"}, file);
+    bytes[compression] = file.str().size();
+    SatEncoder decider{};
+    EXPECT_TRUE(decider.checkSatisfiability(file));
+    EXPECT_EQ(decider.getStats().circuitDepth, 400U);
+  }
+  EXPECT_LT(bytes[LevelCompression::Full] * 10U,
+            bytes[LevelCompression::None]);
+}
+
+TEST_F(SatEncoderTest, PreprocessedCircuitsAreDecidedWithoutSimulation) {
+  std::mt19937 gen(17U);
+  auto         circOne = qc::createRandomCliffordCircuit(3, 8, gen());
+  qc::CircuitOptimizer::flattenOperations(circOne);
+  auto circTwo = circOne;
+  circTwo.h(1);
+  const std::vector<std::string> inputs{"III", "ZIZ", "xyZ"};
+
+  for (const auto check :
+       {EquivalenceCheck::Miter, EquivalenceCheck::Direct,
+        EquivalenceCheck::Unitary}) {
+    Configuration config{};
+    config.equivalenceCheck = check;
+    for (auto* other : {&circOne, &circTwo}) {
+      SatEncoder        direct(config);
+      const auto        expected = direct.testEqual(circOne, *other, inputs);
+      std::stringstream file;
+      SatEncoder(config).preprocess(circOne, *other, inputs, file);
+
+      SatEncoder decider(config);
+      EXPECT_EQ(decider.testEqual(file), expected) << toString(check);
+      EXPECT_EQ(decider.getStats().nrOfGates, direct.getStats().nrOfGates);
+      EXPECT_EQ(decider.getStats().nrOfGenerators,
+                direct.getStats().nrOfGenerators);
+      EXPECT_EQ(decider.getStats().counterexample.found,
+                direct.getStats().counterexample.found);
+      EXPECT_EQ(decider.getStats().counterexample.state,
+                direct.getStats().counterexample.state);
+      EXPECT_EQ(decider.getStats().profile.value(ProfileCounter::GatesApplied),
+                0U);
+    }
+  }
 
-    qubitCnt = 4;
-    for (; qubitCnt < maxNrOfQubits; qubitCnt += stepsize) {
-      std::cout << "Nr Qubits: " << qubitCnt << std::endl;
-      SatEncoder               satEncoder;
-      std::vector<std::string> inputs;
-      for (size_t k = 0; k < 18; k++) {
-        inputs.emplace_back(ipts.at(distr(gen2)));
-      }
+  // a single circuit is checked for satisfiability
+  std::stringstream single;
+  SatEncoder{}.preprocess(circOne, inputs, single);
+  const auto bytes = single.str();
+  SatEncoder satisfiability{};
+  EXPECT_TRUE(satisfiability.checkSatisfiability(single));
+  EXPECT_EQ(satisfiability.getStats().nrOfDiffInputStates, inputs.size());
+
+  // files of another number of circuits, of another check or corrupted files
+  // are rejected
+  std::istringstream one(bytes);
+  EXPECT_THROW(static_cast<void>(SatEncoder{}.testEqual(one)),
+               std::invalid_argument);
+  Configuration unitary{};
+  unitary.equivalenceCheck = EquivalenceCheck::Unitary;
+  std::stringstream miter;
+  SatEncoder{}.preprocess(circOne, circTwo, inputs, miter);
+  EXPECT_THROW(static_cast<void>(SatEncoder(unitary).testEqual(miter)),
+               std::invalid_argument);
+  std::istringstream truncated(bytes.substr(0U, bytes.size() / 2U));
+  EXPECT_THROW(static_cast<void>(SatEncoder{}.checkSatisfiability(truncated)),
+               std::runtime_error);
+
+  // the clause database of a circuit is the instance of generateDIMACS
+  std::stringstream instance;
+  SatEncoder{}.writeSatInstance(circOne, instance);
+  EXPECT_EQ(CnfBuilder::readBinary(instance).toDIMACS(),
+            SatEncoder{}.generateDIMACS(circOne));
+}
 
-      bool result;
-      do {
-        SatEncoder satEncoder1;
-        auto       circThree = qc::createRandomCliffordCircuit(
-            static_cast<qc::Qubit>(qubitCnt), depth, gen());
-        qc::CircuitOptimizer::flattenOperations(circThree);
-        auto                                       circFour = circThree;
-        std::uniform_int_distribution<std::size_t> distr2(
-            0U, circFour.size()); // random error location in circuit
-        circFour.erase(circFour.begin() + static_cast<int>(distr2(gen)));
-        outfile << ", ";
-        result = satEncoder1.testEqual(circThree, circFour,
-                                       inputs); // non-equivalent case
-        outfile << satEncoder1.to_json().dump(2U);
-      } while (result);
+TEST_F(SatEncoderTest, StreamsDIMACSWithMetadata) {
+  std::mt19937 gen(23U);
+  auto         circuit = qc::createRandomCliffordCircuit(4, 10, gen());
+  qc::CircuitOptimizer::flattenOperations(circuit);
+  const auto path = ::testing::TempDir() + "qusat_instance.cnf";
+
+  for (const auto encoding :
+       {EncodingType::Binary, EncodingType::OneHot, EncodingType::Order}) {
+    Configuration config{};
+    config.encoding = encoding;
+    SatEncoder reference(config);
+    const auto dimacs = reference.generateDIMACS(circuit);
+    SatEncoder streaming(config);
+    {
+      DimacsWriter writer(path, false);
+      streaming.writeDIMACS(circuit, writer);
+    }
+    EXPECT_EQ(streaming.getStats().nrOfSatVars,
+              reference.getStats().nrOfSatVars);
+    EXPECT_EQ(streaming.getStats().nrOfFunctionalConstr,
+              reference.getStats().nrOfFunctionalConstr);
+
+    // the comments precede the instance of generateDIMACS
+    std::ifstream            file(path);
+    std::string              line;
+    std::string              clauses;
+    std::vector<std::string> comments;
+    while (std::getline(file, line)) {
+      if (line.rfind("c ", 0U) == 0U) {
+        EXPECT_TRUE(clauses.empty());
+        comments.emplace_back(line);
+      } else {
+        clauses += line + "\n";
+      }
     }
-    outfile << "]}";
-    outfile.close();
-  } catch (std::exception& e) {
-    std::cerr << "EXCEPTION THROWN" << std::endl;
-    std::cout << e.what() << std::endl;
+    EXPECT_EQ(clauses, dimacs);
+    ASSERT_GE(comments.size(), 4U);
+    EXPECT_NE(comments[0].find("encoding " + toString(encoding)),
+              std::string::npos);
+    EXPECT_EQ(comments[2].rfind("c level 0: 1", 0U), 0U);
+    EXPECT_EQ(comments.back().rfind("c input 0: generator ", 0U), 0U);
   }
+  std::remove(path.c_str());
 }
@@ -0,0 +1,551 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "CliffordKernels.hpp"
+#include "GeneratorTable.hpp"
+#include "StabilizerGroup.hpp"
+#include "Tableau.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <gtest/gtest.h>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+// straightforward unpacked reference implementation of the tableau updates
+struct ReferenceState {
+  std::size_t                    n;
+  std::vector<std::vector<bool>> x;
+  std::vector<std::vector<bool>> z;
+  std::vector<int>               r;
+
+  explicit ReferenceState(std::size_t nrOfQubits)
+      : n(nrOfQubits), x(n, std::vector<bool>(n)), z(n, std::vector<bool>(n)),
+        r(n, 0) {
+    for (std::size_t i = 0U; i < n; i++) {
+      z[i][i] = true;
+    }
+  }
+
+  void applyCNOT(std::size_t control, std::size_t target) {
+    for (std::size_t i = 0U; i < n; ++i) {
+      r[i] ^=
+          (x[i][control] * z[i][target]) * (x[i][target] ^ z[i][control] ^ 1);
+      x[i][target]  = x[i][target] ^ x[i][control];
+      z[i][control] = z[i][control] ^ z[i][target];
+    }
+  }
+
+  void applyH(std::size_t target) {
+    for (std::size_t i = 0U; i < n; i++) {
+      r[i] ^= x[i][target] * z[i][target];
+      const bool tmp = x[i][target];
+      x[i][target]   = z[i][target];
+      z[i][target]   = tmp;
+    }
+  }
+
+  void applyS(std::size_t target) {
+    for (std::size_t i = 0U; i < n; ++i) {
+      r[i] ^= x[i][target] * z[i][target];
+      z[i][target] = z[i][target] ^ x[i][target];
+    }
+  }
+
+  [[nodiscard]] std::vector<std::vector<bool>> toGenerator() const {
+    std::vector<std::vector<bool>> result(n, std::vector<bool>((2U * n) + 1U));
+    for (std::size_t i = 0U; i < n; i++) {
+      for (std::size_t j = 0U; j < n; j++) {
+        result[i][j]     = x[i][j];
+        result[i][n + j] = z[i][j];
+      }
+      result[i][2U * n] = r[i] == 1;
+    }
+    return result;
+  }
+};
+} // namespace
+
+TEST(TableauTest, InitialStateIsAllZero) {
+  const Tableau tableau(3);
+  EXPECT_EQ(tableau.words(), 1U);
+  for (std::size_t i = 0U; i < 3U; i++) {
+    for (std::size_t j = 0U; j < 3U; j++) {
+      EXPECT_FALSE(tableau.x(i, j));
+      EXPECT_EQ(tableau.z(i, j), i == j);
+    }
+    EXPECT_FALSE(tableau.r(i));
+  }
+}
+
+TEST(TableauTest, MatchesUnpackedReferenceAcrossWordBoundaries) {
+  const std::size_t                          nrOfQubits = 130U;
+  std::mt19937                               gen(42U);
+  std::uniform_int_distribution<std::size_t> qubit(0U, nrOfQubits - 1U);
+  std::uniform_int_distribution<int>         gate(0, 2);
+
+  Tableau        tableau(nrOfQubits);
+  ReferenceState reference(nrOfQubits);
+  EXPECT_EQ(tableau.words(), 3U);
+
+  for (std::size_t i = 0U; i < 2000U; i++) {
+    const auto target = qubit(gen);
+    switch (gate(gen)) {
+    case 0:
+      tableau.applyH(target);
+      reference.applyH(target);
+      break;
+    case 1:
+      tableau.applyS(target);
+      reference.applyS(target);
+      break;
+    default: {
+      const auto control = qubit(gen);
+      if (control != target) {
+        tableau.applyCNOT(control, target);
+        reference.applyCNOT(control, target);
+      }
+    }
+    }
+  }
+  EXPECT_EQ(tableau.toGenerator(), reference.toGenerator());
+}
+
+TEST(TableauTest, IgnoresOutOfRangeQubits) {
+  Tableau       tableau(2);
+  const Tableau initial = tableau;
+  tableau.applyH(2);
+  tableau.applyS(5);
+  tableau.applyCNOT(0, 2);
+  EXPECT_EQ(tableau, initial);
+}
+
+TEST(TableauTest, VectorizedKernelsMatchScalarKernels) {
+  // 650 rows span ten words, covering full vector lanes and a scalar tail
+  const std::size_t                          nrOfQubits = 650U;
+  std::uniform_int_distribution<std::size_t> qubit(0U, nrOfQubits - 1U);
+  std::uniform_int_distribution<int>         gate(0, 2);
+
+  for (const auto isa : CliffordKernels::available()) {
+    std::mt19937 gen(7U);
+    Tableau      scalar(nrOfQubits);
+    Tableau      vectorized(nrOfQubits);
+    scalar.setKernels(CliffordKernels::get(CliffordKernels::Isa::Scalar));
+    vectorized.setKernels(CliffordKernels::get(isa));
+    EXPECT_EQ(vectorized.getKernels().isa, isa);
+
+    for (std::size_t i = 0U; i < 5000U; i++) {
+      const auto target = qubit(gen);
+      switch (gate(gen)) {
+      case 0:
+        scalar.applyH(target);
+        vectorized.applyH(target);
+        break;
+      case 1:
+        scalar.applyS(target);
+        vectorized.applyS(target);
+        break;
+      default: {
+        const auto control = qubit(gen);
+        if (control != target) {
+          scalar.applyCNOT(control, target);
+          vectorized.applyCNOT(control, target);
+        }
+      }
+      }
+    }
+    EXPECT_EQ(scalar, vectorized) << vectorized.getKernels().name;
+  }
+}
+
+namespace {
+// random tableau obtained from the all-zero state by random H, S and CNOTs
+Tableau randomTableau(const std::size_t nrOfQubits, std::mt19937& gen) {
+  std::uniform_int_distribution<std::size_t> qubit(0U, nrOfQubits - 1U);
+  Tableau                                    tableau(nrOfQubits);
+  for (std::size_t i = 0U; i < 20U * nrOfQubits; i++) {
+    const auto target  = qubit(gen);
+    const auto control = qubit(gen);
+    tableau.applyH(target);
+    tableau.applyS(qubit(gen));
+    if (control != target) {
+      tableau.applyCNOT(control, target);
+    }
+  }
+  return tableau;
+}
+} // namespace
+
+TEST(TableauTest, NativePauliAndSdgKernelsMatchHSSequences) {
+  std::mt19937  gen(3U);
+  const Tableau initial = randomTableau(70U, gen);
+
+  Tableau expected = initial;
+  Tableau native   = initial;
+  // X = H Z H, Z = S S, Y ~ X Z, Sdg = S S S
+  expected.applyH(5);
+  expected.applyS(5);
+  expected.applyS(5);
+  expected.applyH(5);
+  native.applyX(5);
+  EXPECT_EQ(native, expected);
+
+  expected.applyS(6);
+  expected.applyS(6);
+  native.applyZ(6);
+  EXPECT_EQ(native, expected);
+
+  expected.applyZ(7);
+  expected.applyX(7);
+  native.applyY(7);
+  EXPECT_EQ(native, expected);
+
+  expected.applyS(8);
+  expected.applyS(8);
+  expected.applyS(8);
+  native.applySdg(8);
+  EXPECT_EQ(native, expected);
+}
+
+TEST(TableauTest, NativeCliffordKernelsMatchDecompositions) {
+  // 650 rows span ten words, covering full vector lanes and a scalar tail
+  std::mt19937  gen(11U);
+  const Tableau initial = randomTableau(650U, gen);
+  const auto    a       = 3U;
+  const auto    b       = 9U;
+
+  const auto sx = [](Tableau& t, const std::size_t q) {
+    t.applyH(q);
+    t.applyS(q);
+    t.applyH(q);
+  };
+  const std::vector<std::pair<std::function<void(Tableau&)>,
+                              std::function<void(Tableau&)>>>
+      cases{{[&](Tableau& t) { t.applySX(b); }, [&](Tableau& t) { sx(t, b); }},
+            {[&](Tableau& t) { t.applySXdg(b); },
+             [&](Tableau& t) {
+               t.applyH(b);
+               t.applySdg(b);
+               t.applyH(b);
+             }},
+            {[&](Tableau& t) { t.applyCZ(a, b); },
+             [&](Tableau& t) {
+               t.applyH(b);
+               t.applyCNOT(a, b);
+               t.applyH(b);
+             }},
+            {[&](Tableau& t) { t.applyCY(a, b); },
+             [&](Tableau& t) {
+               t.applySdg(b);
+               t.applyCNOT(a, b);
+               t.applyS(b);
+             }},
+            {[&](Tableau& t) { t.applySwap(a, b); },
+             [&](Tableau& t) {
+               t.applyCNOT(a, b);
+               t.applyCNOT(b, a);
+               t.applyCNOT(a, b);
+             }},
+            {[&](Tableau& t) { t.applyISwap(a, b); },
+             [&](Tableau& t) {
+               t.applyS(a);
+               t.applyS(b);
+               t.applyH(a);
+               t.applyCNOT(a, b);
+               t.applyCNOT(b, a);
+               t.applyH(b);
+             }},
+            {[&](Tableau& t) { t.applyISwapdg(a, b); },
+             [&](Tableau& t) {
+               t.applyH(b);
+               t.applyCNOT(b, a);
+               t.applyCNOT(a, b);
+               t.applyH(a);
+               t.applySdg(a);
+               t.applySdg(b);
+             }},
+            {[&](Tableau& t) { t.applyDCX(a, b); },
+             [&](Tableau& t) {
+               t.applyCNOT(a, b);
+               t.applyCNOT(b, a);
+             }},
+            {[&](Tableau& t) { t.applyECR(a, b); },
+             [&](Tableau& t) {
+               t.applyS(a);
+               sx(t, b);
+               t.applyCNOT(a, b);
+               t.applyX(a);
+             }}};
+
+  for (const auto isa : CliffordKernels::available()) {
+    for (std::size_t c = 0U; c < cases.size(); c++) {
+      Tableau native = initial;
+      native.setKernels(CliffordKernels::get(isa));
+      Tableau expected = initial;
+      cases[c].first(native);
+      cases[c].second(expected);
+      EXPECT_EQ(native, expected)
+          << "case " << c << ", " << native.getKernels().name;
+      EXPECT_EQ(native.fingerprint(), expected.fingerprint());
+    }
+  }
+
+  // inverses and squares
+  Tableau tableau = initial;
+  tableau.applyISwap(a, b);
+  tableau.applyISwapdg(a, b);
+  tableau.applySX(a);
+  tableau.applySXdg(a);
+  EXPECT_EQ(tableau, initial);
+  tableau.applySX(b);
+  tableau.applySX(b);
+  tableau.applyX(b);
+  tableau.applyECR(a, b);
+  tableau.applyECR(a, b);
+  EXPECT_EQ(tableau, initial);
+  EXPECT_EQ(SingleQubitClifford::sx().then(SingleQubitClifford::sx()),
+            SingleQubitClifford::x());
+}
+
+TEST(TableauTest, SingleQubitCliffordGroupIsClosedAndFusesRuns) {
+  std::mt19937  gen(5U);
+  const Tableau initial = randomTableau(67U, gen);
+
+  std::vector<Tableau> images{};
+  for (std::uint8_t i = 0U; i < SingleQubitClifford::GROUP_ORDER; i++) {
+    const auto a = SingleQubitClifford::fromIndex(i);
+    Tableau    image = initial;
+    image.applyClifford(3, a);
+    // all 24 elements act differently
+    for (const auto& other : images) {
+      EXPECT_NE(image, other);
+    }
+    images.emplace_back(image);
+
+    for (std::uint8_t j = 0U; j < SingleQubitClifford::GROUP_ORDER; j++) {
+      const auto b = SingleQubitClifford::fromIndex(j);
+      // applying a and then b equals applying the fused element once
+      Tableau sequential = image;
+      sequential.applyClifford(3, b);
+      Tableau fused = initial;
+      fused.applyClifford(3, a.then(b));
+      EXPECT_EQ(sequential, fused);
+    }
+  }
+  EXPECT_TRUE(
+      SingleQubitClifford::x().then(SingleQubitClifford::x()).isIdentity());
+  EXPECT_EQ(SingleQubitClifford::s().then(SingleQubitClifford::sdg()),
+            SingleQubitClifford{});
+}
+
+TEST(TableauTest, IncrementalFingerprintMatchesRecomputation) {
+  std::mt19937                               gen(11U);
+  const std::size_t                          nrOfQubits = 90U;
+  std::uniform_int_distribution<std::size_t> qubit(0U, nrOfQubits - 1U);
+  Tableau                                    tableau(nrOfQubits);
+  const auto                                 initial = tableau.fingerprint();
+
+  for (std::size_t i = 0U; i < 500U; i++) {
+    const auto target  = qubit(gen);
+    const auto control = qubit(gen);
+    tableau.applyH(target);
+    tableau.applyZ(qubit(gen));
+    if (control != target) {
+      tableau.applyCNOT(control, target);
+    }
+    if (i % 50U == 0U) {
+      // a copy rehashes every column from scratch
+      Tableau fresh(nrOfQubits);
+      EXPECT_NE(fresh.fingerprint(), tableau.fingerprint());
+      fresh = tableau;
+      EXPECT_EQ(fresh.fingerprint(), tableau.fingerprint());
+    }
+  }
+  // returning to the initial state restores the initial fingerprint
+  Tableau other(nrOfQubits);
+  other.applyH(4);
+  other.applyS(4);
+  EXPECT_NE(other.fingerprint(), initial);
+  other.applySdg(4);
+  other.applyH(4);
+  EXPECT_EQ(other.fingerprint(), initial);
+}
+
+TEST(TableauTest, IdentityTracksDestabilizers) {
+  const std::size_t nrOfQubits = 40U;
+  auto              identity   = Tableau::identity(nrOfQubits);
+  EXPECT_EQ(identity.rows(), 2U * nrOfQubits);
+  EXPECT_EQ(identity.words(), 2U);
+  for (std::size_t i = 0U; i < nrOfQubits; i++) {
+    for (std::size_t q = 0U; q < nrOfQubits; q++) {
+      EXPECT_EQ(identity.x(i, q), i == q);
+      EXPECT_FALSE(identity.z(i, q));
+      EXPECT_FALSE(identity.x(nrOfQubits + i, q));
+      EXPECT_EQ(identity.z(nrOfQubits + i, q), i == q);
+    }
+  }
+
+  // the stabilizer rows evolve as in the tableau of |0...0>
+  std::mt19937                               gen(43U);
+  std::uniform_int_distribution<std::size_t> qubit(0U, nrOfQubits - 1U);
+  Tableau                                    state(nrOfQubits);
+  for (std::size_t i = 0U; i < 200U; i++) {
+    const auto target  = qubit(gen);
+    const auto control = qubit(gen);
+    for (auto* tableau : {&identity, &state}) {
+      tableau->applyH(target);
+      tableau->applyS(control);
+      if (control != target) {
+        tableau->applyCNOT(control, target);
+      }
+    }
+  }
+  for (std::size_t row = 0U; row < nrOfQubits; row++) {
+    for (std::size_t q = 0U; q < nrOfQubits; q++) {
+      EXPECT_EQ(identity.x(nrOfQubits + row, q), state.x(row, q));
+      EXPECT_EQ(identity.z(nrOfQubits + row, q), state.z(row, q));
+    }
+    EXPECT_EQ(identity.r(nrOfQubits + row), state.r(row));
+  }
+  EXPECT_EQ(StabilizerGroup(identity), StabilizerGroup(state));
+
+  // Z leaves |0> unchanged, but not the destabilizer X
+  auto one = Tableau::identity(1U);
+  one.applyZ(0U);
+  EXPECT_EQ(StabilizerGroup(one), StabilizerGroup(Tableau(1U)));
+  EXPECT_NE(one, Tableau::identity(1U));
+  GeneratorTable table;
+  EXPECT_TRUE(table.intern(Tableau(1U)).second);
+  EXPECT_TRUE(table.intern(Tableau::identity(1U)).second);
+  EXPECT_EQ(table.rows(1U), 2U);
+  EXPECT_EQ(table.toGenerator(1U), Tableau::identity(1U).toGenerator());
+}
+
+TEST(GeneratorTableTest, InternsEqualTableausOnce) {
+  GeneratorTable table;
+  Tableau        tableau(3);
+  EXPECT_EQ(table.intern(tableau), std::make_pair(std::size_t{0U}, true));
+  tableau.applyH(1);
+  EXPECT_EQ(table.intern(tableau), std::make_pair(std::size_t{1U}, true));
+  tableau.applyH(1);
+  EXPECT_EQ(table.intern(tableau), std::make_pair(std::size_t{0U}, false));
+  EXPECT_EQ(table.intern(Tableau(4)), std::make_pair(std::size_t{2U}, true));
+  EXPECT_EQ(table.size(), 3U);
+
+  // generators are stored back to back in the arena and unpack losslessly
+  Tableau expected(3);
+  expected.applyH(1);
+  EXPECT_EQ(table.wordCount(1U), expected.raw().size());
+  EXPECT_EQ(table.words(1U), table.words(0U) + table.wordCount(0U));
+  EXPECT_TRUE(std::equal(expected.raw().begin(), expected.raw().end(),
+                         table.words(1U)));
+  EXPECT_EQ(table.toGenerator(1U), expected.toGenerator());
+  EXPECT_EQ(table.qubits(2U), 4U);
+  EXPECT_EQ(table.toGenerator(2U), Tableau(4).toGenerator());
+}
+
+TEST(StabilizerGroupTest, CanonicalFormIsReducedRowEchelonForm) {
+  // |+> (x) |1> is stabilized by X_0 and -Z_1
+  Tableau tableau(2);
+  tableau.applyCNOT(0, 1);
+  tableau.applyH(0);
+  tableau.applyX(1);
+  const StabilizerGroup group(tableau);
+  EXPECT_TRUE(group.x(0, 0));
+  EXPECT_FALSE(group.z(0, 0));
+  EXPECT_FALSE(group.x(0, 1));
+  EXPECT_FALSE(group.z(0, 1));
+  EXPECT_FALSE(group.r(0));
+  EXPECT_FALSE(group.x(1, 0));
+  EXPECT_FALSE(group.z(1, 0));
+  EXPECT_FALSE(group.x(1, 1));
+  EXPECT_TRUE(group.z(1, 1));
+  EXPECT_TRUE(group.r(1));
+
+  // both Bell states have the rows XX and ZZ, but with different phases
+  Tableau phiPlus(2);
+  phiPlus.applyH(0);
+  phiPlus.applyCNOT(0, 1);
+  Tableau phiMinus = phiPlus;
+  phiMinus.applyZ(1);
+  Tableau flipped(2);
+  flipped.applyH(1);
+  flipped.applyCNOT(1, 0);
+  EXPECT_NE(phiPlus, flipped);
+  EXPECT_EQ(StabilizerGroup(phiPlus), StabilizerGroup(flipped));
+  EXPECT_NE(StabilizerGroup(phiPlus), StabilizerGroup(phiMinus));
+  EXPECT_NE(StabilizerGroup(Tableau(2)), StabilizerGroup(Tableau(3)));
+}
+
+TEST(StabilizerGroupTest, DifferentTableausOfTheSameStateAreEqual) {
+  std::mt19937                               gen(29U);
+  const std::size_t                          nrOfQubits = 70U;
+  std::uniform_int_distribution<std::size_t> qubit(0U, nrOfQubits - 1U);
+  std::uniform_int_distribution<int>         gate(0, 3);
+  for (std::size_t run = 0U; run < 10U; run++) {
+    // CNOT, S and Z leave |0...0> unchanged, but not its tableau
+    Tableau prepared(nrOfQubits);
+    for (std::size_t i = 0U; i < 50U; i++) {
+      const auto target  = qubit(gen);
+      const auto control = qubit(gen);
+      if (control != target) {
+        prepared.applyCNOT(control, target);
+      }
+      prepared.applyS(qubit(gen));
+      prepared.applyZ(qubit(gen));
+    }
+    Tableau plain(nrOfQubits);
+    for (std::size_t i = 0U; i < 300U; i++) {
+      const auto target  = qubit(gen);
+      const auto control = qubit(gen);
+      const auto type    = gate(gen);
+      for (auto* tableau : {&prepared, &plain}) {
+        switch (type) {
+        case 0:
+          tableau->applyH(target);
+          break;
+        case 1:
+          tableau->applyS(target);
+          break;
+        case 2:
+          tableau->applyY(target);
+          break;
+        default:
+          if (control != target) {
+            tableau->applyCNOT(control, target);
+          }
+        }
+      }
+    }
+    EXPECT_NE(prepared, plain);
+    EXPECT_EQ(StabilizerGroup(prepared), StabilizerGroup(plain));
+    // groups of interned generators are the same as of their tableau
+    GeneratorTable table;
+    const auto     id = table.intern(plain).first;
+    EXPECT_EQ(
+        StabilizerGroup(table.words(id), table.qubits(id), table.rows(id)),
+              StabilizerGroup(plain));
+
+    // Z_q changes the state iff it anticommutes with some stabilizer, i.e.,
+    // some row has an x on q
+    const auto q           = qubit(gen);
+    bool       anticommute = false;
+    for (std::size_t row = 0U; row < nrOfQubits; row++) {
+      anticommute |= plain.x(row, q);
+    }
+    Tableau flipped = plain;
+    flipped.applyZ(q);
+    EXPECT_EQ(StabilizerGroup(flipped) != StabilizerGroup(plain), anticommute);
+  }
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "ThreadPool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(ThreadPoolTest, VisitsEveryIndexOnce) {
+  ThreadPool pool(4U);
+  EXPECT_EQ(pool.size(), 4U);
+  std::vector<std::atomic<int>> visits(1000U);
+  for (std::size_t round = 0U; round < 20U; round++) {
+    pool.parallelFor(visits.size(),
+                     [&visits](const std::size_t i) { ++visits[i]; });
+  }
+  for (const auto& count : visits) {
+    EXPECT_EQ(count, 20);
+  }
+}
+
+TEST(ThreadPoolTest, SupportsNestedLoopsAndSingleThread) {
+  for (const std::size_t threads : {1U, 3U}) {
+    ThreadPool               pool(threads);
+    std::atomic<std::size_t> sum{0U};
+    pool.parallelFor(8U, [&](const std::size_t i) {
+      pool.parallelFor(8U, [&](const std::size_t j) { sum += (i * 8U) + j; });
+    });
+    EXPECT_EQ(sum, 63U * 64U / 2U);
+  }
+}
+
+TEST(ThreadPoolTest, RethrowsExceptionsOnCallingThread) {
+  ThreadPool pool(2U);
+  EXPECT_THROW(pool.parallelFor(100U,
+                                [](const std::size_t i) {
+                                  if (i == 42U) {
+                                    throw std::runtime_error("failed");
+                                  }
+                                }),
+               std::runtime_error);
+}
+
+TEST(ThreadPoolTest, SharedPoolServesConcurrentCallers) {
+  const auto pool = ThreadPool::shared();
+  EXPECT_EQ(pool, ThreadPool::shared());
+  EXPECT_GE(pool->size(), 1U);
+  // callers on their own threads, as concurrent encoders would be
+  std::atomic<std::size_t> sum{0U};
+  std::vector<std::thread> callers;
+  for (std::size_t c = 0U; c < 4U; c++) {
+    callers.emplace_back([&] {
+      pool->parallelFor(100U, [&](const std::size_t i) { sum += i; });
+    });
+  }
+  for (auto& caller : callers) {
+    caller.join();
+  }
+  EXPECT_EQ(sum, 4U * 99U * 100U / 2U);
+}